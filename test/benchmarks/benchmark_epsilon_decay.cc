@@ -50,7 +50,9 @@ static void bench_epsilon_decay(benchmark::State& state, bool use_decay, ExtraAr
 BENCHMARK_CAPTURE(bench_epsilon_decay, epsilon_decay_1_model_big_tol, true, "1", "18", "1e-2");
 BENCHMARK_CAPTURE(bench_epsilon_decay, epsilon_decay_2_model_big_tol, true, "2", "19", "1e-2");
 BENCHMARK_CAPTURE(bench_epsilon_decay, epsilon_decay_4_model_big_tol, true, "4", "20", "1e-2");
+BENCHMARK_CAPTURE(bench_epsilon_decay, epsilon_decay_8_model_big_tol, true, "8", "21", "1e-2");
 BENCHMARK_CAPTURE(bench_epsilon_decay, epsilon_decay_1_model_small_tol, true, "1", "18", "1e-6");
 BENCHMARK_CAPTURE(bench_epsilon_decay, epsilon_decay_2_model_small_tol, true, "2", "19", "1e-6");
 BENCHMARK_CAPTURE(bench_epsilon_decay, epsilon_decay_4_model_small_tol, true, "4", "20", "1e-6");
+BENCHMARK_CAPTURE(bench_epsilon_decay, epsilon_decay_8_model_small_tol, true, "8", "21", "1e-6");
 BENCHMARK_CAPTURE(bench_epsilon_decay, without_epsilon_decay, false, "", "", "");
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "vw/config/options_cli.h"
+#include "vw/core/example.h"
+#include "vw/core/learner.h"
+#include "vw/core/vw.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Each example has a few labels drawn from a small block of labels, and features that identify its block, so the tree
+// has something to learn and p@k is meaningful when comparing search strategies.
+static std::vector<std::string> make_plt_examples(uint32_t num_labels, size_t num_examples, std::mt19937& rng)
+{
+  const uint32_t block_size = 8;
+  const uint32_t num_blocks = std::max<uint32_t>(num_labels / block_size, 1);
+  std::uniform_int_distribution<uint32_t> block_dist(0, num_blocks - 1);
+  std::uniform_int_distribution<uint32_t> offset_dist(0, block_size - 1);
+  std::uniform_int_distribution<uint32_t> noise_dist(0, 10000);
+
+  std::vector<std::string> examples;
+  for (size_t i = 0; i < num_examples; ++i)
+  {
+    const uint32_t block = block_dist(rng);
+    std::vector<uint32_t> labels;
+    for (uint32_t j = 0; j < 3; ++j)
+    {
+      labels.push_back(std::min(block * block_size + offset_dist(rng), num_labels - 1));
+    }
+    std::sort(labels.begin(), labels.end());
+    labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+
+    std::stringstream ss;
+    for (size_t j = 0; j < labels.size(); ++j) { ss << (j > 0 ? "," : "") << labels[j]; }
+    ss << " | b" << block << " b" << block << "_" << (block % 7);
+    for (uint32_t j = 0; j < 20; ++j) { ss << " n" << noise_dist(rng); }
+    examples.push_back(ss.str());
+  }
+  return examples;
+}
+
+static void bench_plt_top_k(benchmark::State& state)
+{
+  const auto num_labels = static_cast<uint32_t>(state.range(0));
+  const auto kary = state.range(1);
+  const size_t top_k = 5;
+
+  std::mt19937 rng(42);
+  auto train_examples = make_plt_examples(num_labels, 20000, rng);
+  auto test_examples = make_plt_examples(num_labels, 1000, rng);
+
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(std::vector<std::string>{"--quiet", "--plt",
+      std::to_string(num_labels), "--kary_tree", std::to_string(kary), "--top_k", std::to_string(top_k),
+      "--loss_function", "logistic", "-b", "22", "--random_seed", "1"}));
+
+  for (const auto& line : train_examples)
+  {
+    auto* ex = VW::read_example(*vw, line);
+    vw->learn(*ex);
+    VW::finish_example(*vw, *ex);
+  }
+
+  std::vector<VW::example*> examples;
+  for (const auto& line : test_examples) { examples.push_back(VW::read_example(*vw, line)); }
+
+  double hits = 0;
+  for (auto _ : state)
+  {
+    hits = 0;
+    for (auto* ex : examples)
+    {
+      vw->predict(*ex);
+      const auto& truth = ex->l.multilabels.label_v;
+      for (auto label : ex->pred.multilabels.label_v)
+      {
+        if (std::find(truth.begin(), truth.end(), label) != truth.end()) { hits += 1; }
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+
+  state.counters["p@5"] = hits / static_cast<double>(examples.size() * top_k);
+  state.SetItemsProcessed(state.iterations() * examples.size());
+  for (auto* ex : examples) { VW::finish_example(*vw, *ex); }
+}
+
+BENCHMARK(bench_plt_top_k)
+    ->ArgNames({"labels", "kary"})
+    ->Args({1000, 2})
+    ->Args({1000, 16})
+    ->Args({10000, 2})
+    ->Args({10000, 16})
+    ->Args({100000, 2})
+    ->Args({100000, 16})
+    ->Unit(benchmark::kMillisecond);
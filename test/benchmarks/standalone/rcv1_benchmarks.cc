@@ -5332,3 +5332,7 @@ static void benchmark_rcv1_dataset(benchmark::State& state, const std::string& c
 
 BENCHMARK_CAPTURE(benchmark_rcv1_dataset, simple, "--quiet")->MinTime(15.0);
 BENCHMARK_CAPTURE(benchmark_rcv1_dataset, quadratic, "--quiet -q ::")->MinTime(15.0);
+BENCHMARK_CAPTURE(benchmark_rcv1_dataset, ftrl, "--quiet --ftrl")->MinTime(15.0);
+BENCHMARK_CAPTURE(benchmark_rcv1_dataset, ftrl_quadratic, "--quiet --ftrl -q ::")->MinTime(15.0);
+BENCHMARK_CAPTURE(benchmark_rcv1_dataset, pistol, "--quiet --pistol")->MinTime(15.0);
+BENCHMARK_CAPTURE(benchmark_rcv1_dataset, coin, "--quiet --coin")->MinTime(15.0);
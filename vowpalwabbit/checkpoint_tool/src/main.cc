@@ -0,0 +1,162 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/common/vw_exception.h"
+#include "vw/config/cli_help_formatter.h"
+#include "vw/config/options.h"
+#include "vw/config/options_cli.h"
+#include "vw/core/delta_checkpoint.h"
+#include "vw/core/global_data.h"
+#include "vw/core/memory.h"
+#include "vw/core/vw.h"
+#include "vw/io/io_adapter.h"
+#include "vw/io/logger.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace VW::config;
+
+void print_help(const options_cli& options)
+{
+  const auto& option_groups = options.get_all_option_group_definitions();
+
+  VW::config::cli_help_formatter formatter;
+  std::cout << R"(Usage: vw-checkpoint --log <log> (-o <model> [--base <model>] | --compact <log>)
+
+    Replays a delta checkpoint log written by vw --delta_checkpoint into a regular model, or compacts it into a
+    single record. A log which was continued from an existing model needs that model as --base.
+
+    Note: This is an experimental tool.
+)" << std::endl;
+  std::cout << formatter.format_help(option_groups);
+}
+
+class command_line_options
+{
+public:
+  VW::io::log_level log_level{};
+  VW::io::output_location log_output_stream{};
+  std::string log_file;
+  std::string output_file;
+  std::string base_file;
+  std::string compact_file;
+};
+
+command_line_options parse_command_line(int argc, char** argv, VW::io::logger& logger)
+{
+  std::string log_level;
+  std::string log_output_stream;
+  bool help = false;
+  option_group_definition diagnostics_options("Diagnostics");
+  diagnostics_options.add(make_option("log_level", log_level)
+                              .default_value("info")
+                              .one_of({"info", "warn", "error", "critical", "off"})
+                              .help("Log level for logging messages."));
+  diagnostics_options.add(make_option("log_output", log_output_stream)
+                              .default_value("stderr")
+                              .one_of({"stdout", "stderr"})
+                              .help("Specify the stream to output log messages to."));
+  diagnostics_options.add(make_option("help", help).short_name("h").help("Output this help message."));
+
+  command_line_options result;
+  option_group_definition checkpoint_options("Delta checkpoints");
+  checkpoint_options.add(make_option("log", result.log_file).help("Delta checkpoint log to read. Required."));
+  checkpoint_options.add(
+      make_option("output", result.output_file).short_name('o').help("Name of file of the replayed model."));
+  checkpoint_options.add(
+      make_option("base", result.base_file).short_name('b').help("Model the log was continued from, if any."));
+  checkpoint_options.add(make_option("compact", result.compact_file)
+                             .help("Write the log collapsed into a single record to this file instead of replaying."));
+
+  std::vector<std::string> args(argv + 1, argv + argc);
+  options_cli options(args);
+
+  options.add_and_parse(diagnostics_options);
+  options.add_and_parse(checkpoint_options);
+  auto warnings = options.check_unregistered();
+  _UNUSED(warnings);
+
+  if (help)
+  {
+    print_help(options);
+    std::exit(0);
+  }
+
+  if (result.log_file.empty())
+  {
+    logger.error("Must specify a delta checkpoint log.");
+    print_help(options);
+    std::exit(1);
+  }
+
+  if (result.output_file.empty() == result.compact_file.empty())
+  {
+    logger.error("Must specify exactly one of --output and --compact.");
+    print_help(options);
+    std::exit(1);
+  }
+
+  result.log_level = VW::io::get_log_level(log_level);
+  result.log_output_stream = VW::io::get_output_location(log_output_stream);
+  return result;
+}
+
+int main(int argc, char* argv[])
+{
+  auto logger = VW::io::create_default_logger();
+  try
+  {
+    auto options = parse_command_line(argc, argv, logger);
+    logger.set_level(options.log_level);
+    logger.set_location(options.log_output_stream);
+
+    if (!options.compact_file.empty())
+    {
+      logger.info("Compacting {} into {}", options.log_file, options.compact_file);
+      VW::compact_delta_checkpoints(
+          VW::io::open_file_reader(options.log_file), VW::io::open_file_writer(options.compact_file));
+      return 0;
+    }
+
+    // Without a base model, the state of the last record is a model without weights which is enough to recreate
+    // the workspace. It must outlive the reader, which does not own its memory.
+    std::vector<char> state;
+    std::unique_ptr<VW::io::reader> model_reader;
+    if (!options.base_file.empty())
+    {
+      logger.info("Loading base model: {}", options.base_file);
+      model_reader = VW::io::open_file_reader(options.base_file);
+    }
+    else
+    {
+      state = VW::read_delta_checkpoint_state(VW::io::open_file_reader(options.log_file));
+      model_reader = VW::io::create_buffer_view(state.data(), state.size());
+    }
+
+    auto model = VW::initialize(VW::make_unique<VW::config::options_cli>(std::vector<std::string>{
+                                    "--driver_output_off", "--preserve_performance_counters"}),
+        std::move(model_reader), nullptr, nullptr, &logger);
+
+    logger.info("Replaying: {}", options.log_file);
+    VW::apply_delta_checkpoints(*model, VW::io::open_file_reader(options.log_file));
+
+    logger.info("Saving model: {}", options.output_file);
+    VW::save_predictor(*model, options.output_file);
+  }
+  catch (const VW::vw_exception& e)
+  {
+    logger.critical("({}:{}): {}", e.filename(), e.line_number(), e.what());
+    return 1;
+  }
+  catch (const std::exception& e)
+  {
+    logger.critical("{}", e.what());
+    return 1;
+  }
+
+  return 0;
+}
@@ -101,7 +101,14 @@ public:
   dense_parameters& operator=(dense_parameters&&) noexcept;
   dense_parameters(dense_parameters&&) noexcept;
 
+  // Reserves the weight array without committing it. The array reads as zero and a page is only committed when it is
+  // first written, so resident memory tracks the touched weights as long as the initial weights are zero. Falls back
+  // to a regular allocation on platforms without anonymous mmap.
+  VW_ATTR(nodiscard) static dense_parameters lazy_allocate(size_t length, uint32_t stride_shift = 0);
+
   bool not_null();
+  bool is_lazy() const { return _lazy; }
+
   VW::weight* first() { return _begin.get(); }  // TODO: Temporary fix for allreduce.
 
   VW::weight* data() { return _begin.get(); }
@@ -112,7 +119,7 @@ public:
   iterator begin() { return iterator(_begin.get(), _begin.get(), stride_shift()); }
   iterator end() { return iterator(_begin.get() + _weight_mask + 1, _begin.get(), stride_shift()); }
 
-  // const iterator
+  // const iterator, reading through it does not commit the pages of lazily allocated weights
   const_iterator cbegin() const { return const_iterator(_begin.get(), _begin.get(), stride_shift()); }
   const_iterator cend() const { return const_iterator(_begin.get() + _weight_mask + 1, _begin.get(), stride_shift()); }
 
@@ -165,6 +172,7 @@ private:
   std::shared_ptr<VW::weight> _begin;
   uint64_t _weight_mask;  // (stride*(1 << num_bits) -1)
   uint32_t _stride_shift;
+  bool _lazy = false;  // reserved with lazy_allocate
 };
 }  // namespace VW
 using dense_parameters VW_DEPRECATED("dense_parameters moved into VW namespace") = VW::dense_parameters;
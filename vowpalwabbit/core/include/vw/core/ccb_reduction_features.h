@@ -5,8 +5,10 @@
 #pragma once
 
 #include "vw/common/future_compat.h"
+#include "vw/core/constant.h"
 #include "vw/core/v_array.h"
 
+#include <bitset>
 #include <cstdint>
 
 namespace VW
@@ -24,7 +26,18 @@ class ccb_reduction_features
 public:
   ccb_example_type type;
   VW::v_array<uint32_t> explicit_included_actions;
-  void clear() { explicit_included_actions.clear(); }
+
+  // Set on the actions while ccb predicts the slots of one decision. Only the features of slot_namespaces differ from
+  // one slot to the next, so the base learner may reuse everything else across the slots of decision_id.
+  uint64_t decision_id = 0;
+  std::bitset<VW::NUM_NAMESPACES> slot_namespaces;
+
+  void clear()
+  {
+    explicit_included_actions.clear();
+    decision_id = 0;
+    slot_namespaces.reset();
+  }
 };
 }  // namespace VW
 
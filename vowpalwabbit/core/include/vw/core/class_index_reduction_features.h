@@ -0,0 +1,53 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace VW
+{
+namespace class_index
+{
+// Maps the weight index of a feature for class 0 to the sorted classes whose weight for that feature is non zero.
+// Features without an entry have not been scored yet, gd builds their entry from the weights the first time it needs
+// it and afterwards adds every class it trains on the feature.
+class posting_lists
+{
+public:
+  std::unordered_map<uint64_t, std::vector<uint32_t>> classes;
+};
+
+// Set by a one-against-all reduction (--sparse_class_index) while it calls base for its classes. Class i reads its
+// weights at base_offset + i * class_step. gd keeps index up to date when it learns and multipredict only accumulates
+// the classes listed for each feature.
+class reduction_features
+{
+public:
+  posting_lists* index = nullptr;
+  uint64_t base_offset = 0;
+  size_t class_count = 0;
+  size_t class_step = 0;
+
+  bool active() const { return index != nullptr; }
+  void set(posting_lists& posting, uint64_t offset, size_t count, size_t step)
+  {
+    index = &posting;
+    base_offset = offset;
+    class_count = count;
+    class_step = step;
+  }
+  void reset_to_default()
+  {
+    index = nullptr;
+    base_offset = 0;
+    class_count = 0;
+    class_step = 0;
+  }
+};
+}  // namespace class_index
+}  // namespace VW
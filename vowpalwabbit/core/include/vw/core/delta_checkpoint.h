@@ -0,0 +1,67 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/io_buf.h"
+#include "vw/core/vw_fwd.h"
+#include "vw/io/io_adapter.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace VW
+{
+// A delta checkpoint log is an append-only sequence of records. Each record holds the model state without the
+// weights, as written by save_predictor, followed by the blocks of weights which changed since the previous record.
+//
+// Record layout, in native byte order:
+//   char[4] "VWDC", uint32 version, uint8 kind,
+//   uint64 weight count, uint32 stride shift, uint64 block size (in weights),
+//   uint64 state size, state bytes,
+//   uint64 block count, then for each block: uint64 block index, float[block size]
+//
+// A FULL record lists every block which is not all zeros, blocks it does not list are zero. A DELTA record only lists
+// the blocks which changed since the previous record, so replaying a log which starts with a DELTA record needs the
+// model the log was started from.
+class delta_checkpoint_writer
+{
+public:
+  static constexpr uint64_t DEFAULT_BLOCK_SIZE = 1 << 14;
+
+  // When start_from_current is true the current weights are the base model of the log and the first record is a
+  // DELTA, otherwise the first record is a FULL snapshot. Only dense weights are supported.
+  delta_checkpoint_writer(VW::workspace& all, std::unique_ptr<VW::io::writer> log, bool start_from_current,
+      uint64_t block_size = DEFAULT_BLOCK_SIZE);
+
+  // Appends a record with every block which changed since the previous checkpoint and the current model state.
+  void checkpoint();
+
+  uint64_t checkpoints_written() const { return _checkpoints_written; }
+  uint64_t blocks_in_last_checkpoint() const { return _blocks_in_last_checkpoint; }
+
+private:
+  VW::workspace& _all;
+  VW::io_buf _log;
+  uint64_t _block_size;
+  std::vector<uint64_t> _block_hashes;
+  bool _next_is_full;
+  uint64_t _checkpoints_written = 0;
+  uint64_t _blocks_in_last_checkpoint = 0;
+};
+
+// Applies every record of a delta checkpoint log to the weights of all and loads the model state of the last record.
+// all must have been loaded from the base model of the log or, if the log starts with a FULL record, created with
+// compatible options, for example from the state returned by read_delta_checkpoint_state.
+void apply_delta_checkpoints(VW::workspace& all, std::unique_ptr<VW::io::reader> log);
+
+// Returns the model state of the last record of the log. It is a regular model file without weights, so it can be
+// used to create a workspace to replay the log onto.
+std::vector<char> read_delta_checkpoint_state(std::unique_ptr<VW::io::reader> log);
+
+// Collapses a log into a single record holding the latest content of every block and the latest model state.
+// The log is read twice, so the reader must be resettable.
+void compact_delta_checkpoints(std::unique_ptr<VW::io::reader> log, std::unique_ptr<VW::io::writer> output);
+}  // namespace VW
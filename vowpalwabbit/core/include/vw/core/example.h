@@ -35,6 +35,8 @@ class workspace;
 namespace VW
 {
 void copy_example_data(example* dst, const example* src);
+template <typename IndexMapT>
+void copy_example_data_with_index_map(example* dst, const example* src, const IndexMapT& index_map);
 void setup_example(VW::workspace& all, example* ae);
 
 class polylabel
@@ -138,6 +140,8 @@ public:
   }
 
   friend void VW::copy_example_data(example* dst, const example* src);
+  template <typename IndexMapT>
+  friend void VW::copy_example_data_with_index_map(example* dst, const example* src, const IndexMapT& index_map);
   friend void VW::setup_example(VW::workspace& all, example* ae);
 
 private:
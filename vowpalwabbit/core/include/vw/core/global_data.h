@@ -60,6 +60,7 @@ using options_deleter_type = void (*)(VW::config::options_i*);
 class workspace;
 
 class all_reduce_base;
+class delta_checkpoint_writer;
 enum class all_reduce_type;
 
 class default_reduction_stack_setup;
@@ -153,6 +154,8 @@ public:
   bool save_per_pass;
   std::string per_feature_regularizer_output;
   std::string per_feature_regularizer_text;
+  std::string delta_checkpoint_log;
+  uint64_t delta_checkpoint_period = 0;
 };
 
 class passes_config
@@ -178,6 +181,7 @@ public:
   bool random_positive_weights;  // for initialize_regressor w/ new_mf
   bool normal_weights;
   bool tnormal_weights;
+  bool lazy_weights;  // reserve dense weights and commit pages on first write
   std::string per_feature_regularizer_input;
 };
 
@@ -241,6 +245,10 @@ public:
   std::unique_ptr<all_reduce_base> all_reduce;
   VW::details::generate_interactions_object_cache generate_interactions_object_cache_state;
   uint64_t parse_mask;  // 1 << num_bits -1
+  // Set while a delta checkpoint saves or loads the model state, the weights are stored separately in the log.
+  bool skip_weights_save_load = false;
+  // Threads the merge functions of the reductions may use while VW::merge_models merges into this workspace.
+  size_t merge_threads = 1;
 };
 
 class parser_runtime
@@ -286,6 +294,8 @@ public:
   // Prediction output
   std::vector<std::unique_ptr<VW::io::writer>> final_prediction_sink;  // set to send global predictions to.
   std::unique_ptr<VW::io::writer> raw_prediction;                      // file descriptors for text output.
+
+  std::unique_ptr<VW::delta_checkpoint_writer> delta_checkpoints;
 };
 }  // namespace details
 
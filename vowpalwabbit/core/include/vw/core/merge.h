@@ -48,10 +48,12 @@ private:
  * all models are assumed to be trained from scratch.
  * @param workspaces_to_merge Vector of workspaces to merge.
  * @param logger Optional logger to be used for logging during function and is given to the resulting workspace
+ * @param num_threads Number of threads used to merge dense weights. The result does not depend on it.
  * @return std::unique_ptr<VW::workspace> Pointer to the resulting workspace.
  */
 std::unique_ptr<VW::workspace> merge_models(const VW::workspace* base_workspace,
-    const std::vector<const VW::workspace*>& workspaces_to_merge, VW::io::logger* logger = nullptr);
+    const std::vector<const VW::workspace*>& workspaces_to_merge, VW::io::logger* logger = nullptr,
+    size_t num_threads = 1);
 
 /**
  * Merge several model deltas into a single delta. This merges weights
@@ -63,10 +65,11 @@ std::unique_ptr<VW::workspace> merge_models(const VW::workspace* base_workspace,
  *
  * @param deltas_to_merge Vector of model deltas to merge.
  * @param logger Optional logger to be used for logging during function and is given to the resulting workspace
+ * @param num_threads Number of threads used to merge dense weights. The result does not depend on it.
  * @return std::unique_ptr<VW::workspace> Pointer to the resulting workspace.
  */
-VW::model_delta merge_deltas(
-    const std::vector<const VW::model_delta*>& deltas_to_merge, VW::io::logger* logger = nullptr);
+VW::model_delta merge_deltas(const std::vector<const VW::model_delta*>& deltas_to_merge,
+    VW::io::logger* logger = nullptr, size_t num_threads = 1);
 
 std::unique_ptr<VW::workspace> operator+(const VW::workspace& ws, const VW::model_delta& md);
 VW::model_delta operator-(const VW::workspace& ws1, const VW::workspace& ws2);
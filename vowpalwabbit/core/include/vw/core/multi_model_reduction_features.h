@@ -0,0 +1,44 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VW
+{
+namespace multi_model
+{
+// Set by a multi-model reduction while it runs each of its models in turn on the same examples, see
+// VW::reductions::multi_model::begin_fused_pass. Model i of the pass reads its weights at
+// base_offset + i * model_step.
+class reduction_features
+{
+public:
+  uint64_t pass_id = 0;
+  uint64_t base_offset = 0;
+  size_t model_count = 0;
+  size_t model_step = 0;
+
+  bool fused() const { return model_count > 1; }
+  void reset_to_default()
+  {
+    pass_id = 0;
+    base_offset = 0;
+    model_count = 0;
+    model_step = 0;
+  }
+};
+
+// Kept by each multi-model reduction for its fused passes. can_fuse is decided once at setup, see
+// VW::reductions::multi_model::can_fuse_models, and pass_count numbers the passes of this reduction.
+class fused_pass_state
+{
+public:
+  bool can_fuse = false;
+  uint64_t pass_count = 0;
+};
+}  // namespace multi_model
+}  // namespace VW
@@ -5,7 +5,13 @@
 
 #include "vw/common/random.h"
 #include "vw/core/array_parameters_dense.h"
+#include "vw/core/example.h"
 #include "vw/core/learner.h"
+#include "vw/core/multi_model_reduction_features.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
 
 namespace VW
 {
@@ -131,6 +137,70 @@ inline void reduce_innermost_model_weights(dense_parameters& weights, const size
     }
   }
 }
+
+// Whether the models of base can be predicted from one traversal of the features. This only holds when every reduction
+// between base and gd passes the features through untouched. Reductions such as lrq and lrqfa derive features from the
+// weights of the model being predicted, so each model sees different features.
+inline bool can_fuse_models(const VW::LEARNER::learner& base)
+{
+  static const char* const feature_preserving[] = {
+      "scorer", "csoaa_ldf", "cb_adf", "cb_explore_adf_greedy", "generate_interactions"};
+  for (const auto* l = &base; l != nullptr; l = l->get_base_learner())
+  {
+    const auto& name = l->get_name();
+    if (l->get_base_learner() == nullptr) { return name == "gd"; }
+    if (std::none_of(std::begin(feature_preserving), std::end(feature_preserving),
+            [&name](const char* prefix) { return name.compare(0, std::strlen(prefix), prefix) == 0; }))
+    {
+      return false;
+    }
+  }
+  return false;
+}
+
+namespace details
+{
+inline void mark_fused_pass(VW::example& ec, const VW::LEARNER::learner& base, size_t model_count, uint64_t pass_id)
+{
+  auto& fused = ec.ex_reduction_features.template get<VW::multi_model::reduction_features>();
+  fused.pass_id = pass_id;
+  fused.base_offset = ec.ft_offset;
+  fused.model_count = model_count;
+  fused.model_step = base.feature_width_below;
+}
+}  // namespace details
+
+// Marks examples which are about to be learned or predicted by each of the model_count models of base in turn, with no
+// changes to their features in between. gd then computes the predictions of all models in a single traversal of the
+// features instead of one traversal per model. Nothing is marked unless state.can_fuse, which the reduction sets at
+// setup from can_fuse_models(base). Must be paired with end_fused_pass.
+inline void begin_fused_pass(VW::multi_ex& examples, const VW::LEARNER::learner& base, size_t model_count,
+    VW::multi_model::fused_pass_state& state)
+{
+  if (!state.can_fuse) { return; }
+  const uint64_t pass_id = ++state.pass_count;
+  for (auto* ex : examples) { details::mark_fused_pass(*ex, base, model_count, pass_id); }
+}
+
+inline void begin_fused_pass(VW::example& ec, const VW::LEARNER::learner& base, size_t model_count,
+    VW::multi_model::fused_pass_state& state)
+{
+  if (!state.can_fuse) { return; }
+  details::mark_fused_pass(ec, base, model_count, ++state.pass_count);
+}
+
+inline void end_fused_pass(VW::multi_ex& examples)
+{
+  for (auto* ex : examples)
+  {
+    ex->ex_reduction_features.template get<VW::multi_model::reduction_features>().reset_to_default();
+  }
+}
+
+inline void end_fused_pass(VW::example& ec)
+{
+  ec.ex_reduction_features.template get<VW::multi_model::reduction_features>().reset_to_default();
+}
 }  // namespace multi_model
 }  // namespace reductions
 }  // namespace VW
\ No newline at end of file
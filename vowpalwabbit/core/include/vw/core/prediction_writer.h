@@ -0,0 +1,83 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/queue.h"
+#include "vw/core/v_array.h"
+#include "vw/io/io_adapter.h"
+#include "vw/io/logger.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace VW
+{
+enum class prediction_output_format
+{
+  TEXT,
+  BINARY
+};
+
+// Writer used for -p and -r which stages predictions into a ring of buffers and leaves float formatting and the
+// actual I/O to a background thread, so the learner thread never blocks on the output file.
+//
+// Scalar predictions go through write_scalar, which only copies the value and tag. Anything else written through
+// write() is staged as raw bytes and emitted unchanged and in order.
+//
+// In the BINARY format each record starts with a one byte kind:
+//   SCALAR_RECORD: float32 value, uint32 tag length, tag bytes
+//   TEXT_RECORD:   uint32 length, bytes
+// All integers and floats are written in native byte order.
+class async_prediction_writer : public VW::io::writer
+{
+public:
+  static constexpr uint8_t SCALAR_RECORD = 0;
+  static constexpr uint8_t TEXT_RECORD = 1;
+
+  async_prediction_writer(std::unique_ptr<VW::io::writer> inner, prediction_output_format format,
+      VW::io::logger logger, size_t buffer_size = 1 << 16, size_t num_buffers = 8);
+  ~async_prediction_writer() override;
+
+  // Stages raw bytes, returns num_bytes as the actual write happens later.
+  ssize_t write(const char* buffer, size_t num_bytes) override;
+
+  // Stages a scalar prediction which is formatted the same way as VW::details::print_result_by_ref.
+  void write_scalar(float value, const VW::v_array<char>& tag);
+
+  // Blocks until everything staged so far has been written to the inner writer, then flushes it.
+  void flush() override;
+
+  prediction_output_format format() const { return _format; }
+
+private:
+  void submit_current();
+  void drain();
+  void write_out(const std::vector<char>& staged);
+  void report_errors();
+
+  std::unique_ptr<VW::io::writer> _inner;
+  prediction_output_format _format;
+  VW::io::logger _logger;
+  size_t _buffer_size;
+
+  std::vector<char> _current;
+  VW::thread_safe_queue<std::vector<char>> _free;
+  VW::thread_safe_queue<std::vector<char>> _filled;
+
+  std::mutex _written_mutex;
+  std::condition_variable _written_cv;
+  uint64_t _submitted = 0;
+  uint64_t _written = 0;
+  std::atomic<uint64_t> _failed_writes{0};
+
+  std::vector<char> _formatted;
+  std::thread _worker;
+};
+}  // namespace VW
@@ -7,9 +7,11 @@
 #include "vw/common/future_compat.h"
 #include "vw/core/cb_graph_feedback_reduction_features.h"
 #include "vw/core/ccb_reduction_features.h"
+#include "vw/core/class_index_reduction_features.h"
 #include "vw/core/continuous_actions_reduction_features.h"
 #include "vw/core/epsilon_reduction_features.h"
 #include "vw/core/large_action_space_reduction_features.h"
+#include "vw/core/multi_model_reduction_features.h"
 #include "vw/core/simple_label.h"
 
 /*
@@ -51,6 +53,8 @@ public:
     _epsilon_reduction_features.reset_to_default();
     _large_action_space_reduction_features.reset_to_default();
     _cb_graph_feedback_reduction_features.clear();
+    _multi_model_reduction_features.reset_to_default();
+    _class_index_reduction_features.reset_to_default();
   }
 
 private:
@@ -60,6 +64,8 @@ private:
   VW::cb_explore_adf::greedy::reduction_features _epsilon_reduction_features;
   VW::large_action_space::las_reduction_features _large_action_space_reduction_features;
   VW::cb_graph_feedback::reduction_features _cb_graph_feedback_reduction_features;
+  VW::multi_model::reduction_features _multi_model_reduction_features;
+  VW::class_index::reduction_features _class_index_reduction_features;
 };
 
 template <>
@@ -139,6 +145,30 @@ reduction_features::get<VW::cb_graph_feedback::reduction_features>() const
 {
   return _cb_graph_feedback_reduction_features;
 }
+
+template <>
+inline VW::multi_model::reduction_features& reduction_features::get<VW::multi_model::reduction_features>()
+{
+  return _multi_model_reduction_features;
+}
+
+template <>
+inline const VW::multi_model::reduction_features& reduction_features::get<VW::multi_model::reduction_features>() const
+{
+  return _multi_model_reduction_features;
+}
+
+template <>
+inline VW::class_index::reduction_features& reduction_features::get<VW::class_index::reduction_features>()
+{
+  return _class_index_reduction_features;
+}
+
+template <>
+inline const VW::class_index::reduction_features& reduction_features::get<VW::class_index::reduction_features>() const
+{
+  return _class_index_reduction_features;
+}
 }  // namespace VW
 
 using reduction_features VW_DEPRECATED("reduction_features moved into VW namespace") = VW::reduction_features;
\ No newline at end of file
@@ -53,7 +53,7 @@ emt_scorer_type emt_scorer_type_from_string(VW::string_view val);
 emt_router_type emt_router_type_from_string(VW::string_view val);
 emt_initial_type emt_initial_type_from_string(VW::string_view val);
 
-float emt_initial(emt_initial_type initial_type, emt_feats f1, emt_feats f2);
+float emt_initial(emt_initial_type initial_type, const emt_feats& f1, const emt_feats& f2);
 float emt_median(std::vector<float>&);
 float emt_inner(const emt_feats&, const emt_feats&);
 float emt_norm(const emt_feats&);
@@ -61,6 +61,9 @@ void emt_scale(emt_feats&, float);
 void emt_normalize(emt_feats&);
 emt_feats emt_scale_add(float, const emt_feats&, float, const emt_feats&);
 emt_feats emt_router_eigen(std::vector<emt_feats>&, VW::rand_state&);
+// 64 bit random hyperplane (SimHash) signature of the direction of the features. The number of differing bits
+// between two sketches estimates the angle between the two feature vectors.
+uint64_t emt_sketch(const emt_feats&);
 
 template <typename RandomIt>
 void emt_shuffle(RandomIt first, RandomIt last, VW::rand_state& rng)
@@ -83,6 +86,7 @@ struct emt_example
   emt_feats base;  // base example only includes the base features without interaction flags
   emt_feats full;  // full example includes the interactions that were passed in as flags
   uint32_t label = 0;
+  uint64_t sketch = 0;  // emt_sketch of full, only set when max_candidates > 0 and not saved in the model
 
   emt_example() = default;
   emt_example(VW::workspace&, VW::example*);
@@ -123,6 +127,11 @@ struct emt_tree
   emt_router_type router_type = emt_router_type::EIGEN;
   emt_initial_type initial_type = emt_initial_type::COSINE;
 
+  // When a leaf has more memories than this, only the ones with the closest sketches are scored. 0 scores all of them.
+  uint32_t max_candidates = 0;
+  std::vector<size_t> candidates;
+  std::vector<std::pair<uint32_t, size_t>> candidate_distances;
+
   std::unique_ptr<VW::example> ex;  // we create one of these which we re-use so we don't have to reallocate examples
   std::unique_ptr<std::vector<std::vector<VW::namespace_index>>> empty_interactions_for_ex;
   std::unique_ptr<std::vector<std::vector<extent_term>>> empty_extent_interactions_for_ex;
@@ -6,6 +6,7 @@
 #include "vw/core/estimators/confidence_sequence_robust.h"
 #include "vw/core/io_buf.h"
 #include "vw/core/learner_fwd.h"
+#include "vw/core/multi_model_reduction_features.h"
 #include "vw/core/vw_fwd.h"
 
 #include <memory>
@@ -55,6 +56,7 @@ public:
   bool _reward_as_cost;
   bool _predict_only_model;
   bool _challenger_epsilon;
+  VW::multi_model::fused_pass_state _fused_passes;
 };
 
 }  // namespace epsilon_decay
@@ -9,6 +9,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace VW
 {
@@ -38,6 +39,10 @@ public:
   size_t early_stop_thres = 0;
   uint32_t ftrl_size = 0;
   std::vector<VW::reductions::details::gd_per_model_state> gd_per_model_states;
+  // Weight indices and values of the features of the current example, collected once for the block kernels and
+  // reused by the update that follows the prediction.
+  std::vector<uint64_t> feature_indices;
+  std::vector<float> feature_values;
 };
 
 namespace model_utils
@@ -15,7 +15,10 @@
 // we need it for learner
 #include "vw/core/vw_fwd.h"
 
+#include <array>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace VW
 {
@@ -32,13 +35,69 @@ public:
   double normalized_sum_norm_x = 0.0;
   double total_weight = 0.0;
 };
+
+// Raw predictions of every model of a fused multi-model pass for one example. Each prediction is valid while the
+// generation of its model is unchanged.
+class gd_fused_prediction
+{
+public:
+  float initial = 0.f;
+  size_t num_features = 0;
+  const void* interactions = nullptr;
+  size_t num_interacted_features = 0;
+  std::vector<float> predictions;
+  std::vector<uint64_t> generations;
+};
+
+class gd_fused_predictions
+{
+public:
+  uint64_t pass_id = 0;
+  std::vector<uint64_t> model_generations;  // bumped whenever gd changes the weights of a model
+  std::unordered_map<const VW::example*, size_t> index;
+  std::vector<gd_fused_prediction> entries;  // reused across passes, only the first index.size() are in use
+};
+
+// Raw prediction of the features of an example which stay the same across the slots of a ccb decision.
+class gd_slot_invariant_prediction
+{
+public:
+  uint64_t ft_offset = 0;
+  size_t num_features = 0;
+  float prediction = 0.f;
+  size_t num_interacted_features = 0;
+};
+
+class gd_slot_invariant_predictions
+{
+public:
+  uint64_t decision_id = 0;
+  std::unordered_map<const VW::example*, gd_slot_invariant_prediction> entries;
+  // linear namespaces to skip for the slot invariant and the per slot part of the prediction
+  std::array<bool, VW::NUM_NAMESPACES> ignore_invariant_linear;
+  std::array<bool, VW::NUM_NAMESPACES> ignore_slot_linear;
+  // interactions of the last example split into the slot invariant and the per slot ones, they are reused for as long
+  // as the examples have the same interactions and namespaces
+  const void* split_interactions_source = nullptr;
+  const void* split_extent_interactions_source = nullptr;
+  std::vector<VW::namespace_index> split_indices;
+  std::vector<std::vector<VW::namespace_index>> invariant_interactions;
+  std::vector<std::vector<VW::namespace_index>> slot_interactions;
+  std::vector<std::vector<VW::extent_term>> invariant_extent_interactions;
+  std::vector<std::vector<VW::extent_term>> slot_extent_interactions;
+};
 }  // namespace details
 
 class gd
 {
 public:
-  gd(size_t feature_width_above = 1) : gd_per_model_states(feature_width_above) {}
+  gd(size_t feature_width_above = 1) : gd_per_model_states(feature_width_above)
+  {
+    fused_predictions.model_generations.resize(feature_width_above);
+  }
   std::vector<VW::reductions::details::gd_per_model_state> gd_per_model_states;
+  VW::reductions::details::gd_fused_predictions fused_predictions;
+  VW::reductions::details::gd_slot_invariant_predictions slot_invariant_predictions;
   VW::reductions::details::gd_per_model_state* current_model_state = nullptr;
   size_t no_win_counter = 0;
   size_t early_stop_thres = 0;
@@ -35,6 +35,7 @@
 #include "vw/core/setup_base.h"
 #include "vw/core/vw_fwd.h"
 
+#include <algorithm>
 #include <memory>
 
 namespace VW
@@ -265,6 +266,35 @@ void copy_example_metadata(example*, const example*);
 void copy_example_data(example*, const example*);  // metadata + features, don't copy the label
 void copy_example_data_with_label(example* dst, const example* src);
 
+// Same as copy_example_data, but every feature index is written as index_map(index). The feature groups of dst keep
+// their buffers, so an example that is refilled for every input stops allocating once it has grown to the largest one.
+template <typename IndexMapT>
+void copy_example_data_with_index_map(example* dst, const example* src, const IndexMapT& index_map)
+{
+  copy_example_metadata(dst, src);
+
+  dst->indices = src->indices;
+  for (namespace_index c : src->indices)
+  {
+    const features& from = src->feature_space[c];
+    features& to = dst->feature_space[c];
+    to.values.resize(from.values.size());
+    std::copy(from.values.begin(), from.values.end(), to.values.begin());
+    to.indices.resize(from.indices.size());
+    std::transform(from.indices.begin(), from.indices.end(), to.indices.begin(), index_map);
+    to.space_names = from.space_names;
+    to.namespace_extents = from.namespace_extents;
+    to.sum_feat_sq = from.sum_feat_sq;
+  }
+  dst->num_features = src->num_features;
+  dst->total_sum_feat_sq = src->total_sum_feat_sq;
+  dst->_total_sum_feat_sq_calculated = src->_total_sum_feat_sq_calculated;
+  dst->_use_permutations = src->_use_permutations;
+  dst->interactions = src->interactions;
+  dst->extent_interactions = src->extent_interactions;
+  dst->debug_current_reduction_depth = src->debug_current_reduction_depth;
+}
+
 // after export_example, must call releaseFeatureSpace to free native memory
 primitive_feature_space* export_example(VW::workspace& all, example* e, size_t& len);
 void release_feature_space(primitive_feature_space* features, size_t len);
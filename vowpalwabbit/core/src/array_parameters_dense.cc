@@ -4,10 +4,13 @@
 
 #include "vw/core/array_parameters_dense.h"
 
+#include "vw/common/vw_exception.h"
 #include "vw/core/memory.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 
 #ifndef _WIN32
 #  include <sys/mman.h>
@@ -27,13 +30,48 @@ VW::dense_parameters::dense_parameters(size_t length, uint32_t stride_shift)
 {
 }
 
+namespace
+{
+// Number of weights in a 4KiB page, deep_copy of lazily allocated weights skips pages which are all zero.
+constexpr size_t LAZY_PAGE_FLOATS = 1024;
+
+std::shared_ptr<VW::weight> make_reserved_weights(size_t float_count)
+{
+#if !defined(_WIN32) && defined(MAP_NORESERVE)
+  void* reserved = mmap(nullptr, float_count * sizeof(VW::weight), PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (reserved == MAP_FAILED) { THROW("internal error: could not reserve " << float_count << " weights"); }
+  return std::shared_ptr<VW::weight>(static_cast<VW::weight*>(reserved),
+      [float_count](VW::weight* ptr) { munmap(ptr, float_count * sizeof(VW::weight)); });
+#else
+  THROW("lazily allocated weights are not supported on this platform, " << float_count << " weights requested");
+#endif
+}
+}  // namespace
+
 VW::dense_parameters::dense_parameters() : _begin(nullptr), _weight_mask(0), _stride_shift(0) {}
 
+VW::dense_parameters VW::dense_parameters::lazy_allocate(size_t length, uint32_t stride_shift)
+{
+#if !defined(_WIN32) && defined(MAP_NORESERVE)
+  const size_t float_count = length << stride_shift;
+  dense_parameters return_val;
+  return_val._begin = make_reserved_weights(float_count);
+  return_val._weight_mask = float_count - 1;
+  return_val._stride_shift = stride_shift;
+  return_val._lazy = true;
+  return return_val;
+#else
+  return dense_parameters(length, stride_shift);
+#endif
+}
+
 VW::dense_parameters& VW::dense_parameters::operator=(dense_parameters&& other) noexcept
 {
   _begin = std::move(other._begin);
   _weight_mask = other._weight_mask;
   _stride_shift = other._stride_shift;
+  _lazy = other._lazy;
   return *this;
 }
 
@@ -42,6 +80,7 @@ VW::dense_parameters::dense_parameters(dense_parameters&& other) noexcept
   _begin = std::move(other._begin);
   _weight_mask = other._weight_mask;
   _stride_shift = other._stride_shift;
+  _lazy = other._lazy;
 }
 bool VW::dense_parameters::not_null() { return (_weight_mask > 0 && _begin != nullptr); }
 
@@ -51,6 +90,7 @@ VW::dense_parameters VW::dense_parameters::shallow_copy(const dense_parameters&
   return_val._begin = input._begin;
   return_val._weight_mask = input._weight_mask;
   return_val._stride_shift = input._stride_shift;
+  return_val._lazy = input._lazy;
   return return_val;
 }
 
@@ -58,16 +98,42 @@ VW::dense_parameters VW::dense_parameters::deep_copy(const dense_parameters& inp
 {
   dense_parameters return_val;
   auto length = input._weight_mask + 1;
-  return_val._begin.reset(VW::details::calloc_mergable_or_throw<VW::weight>(length), free);
+  if (input.is_lazy())
+  {
+    // Only copy the pages holding non zero weights, the rest stay reserved in the copy as well.
+    return_val._begin = make_reserved_weights(length);
+    return_val._lazy = true;
+    for (uint64_t begin = 0; begin < length; begin += LAZY_PAGE_FLOATS)
+    {
+      const auto page_floats = std::min<uint64_t>(LAZY_PAGE_FLOATS, length - begin);
+      const VW::weight* src = input._begin.get() + begin;
+      if (std::any_of(src, src + page_floats, [](VW::weight w) { return w != 0.f; }))
+      {
+        std::memcpy(return_val._begin.get() + begin, src, page_floats * sizeof(VW::weight));
+      }
+    }
+  }
+  else
+  {
+    return_val._begin.reset(VW::details::calloc_mergable_or_throw<VW::weight>(length), free);
+    std::memcpy(return_val._begin.get(), input._begin.get(), length * sizeof(VW::weight));
+  }
   return_val._weight_mask = input._weight_mask;
   return_val._stride_shift = input._stride_shift;
-  std::memcpy(return_val._begin.get(), input._begin.get(), length * sizeof(VW::weight));
   return return_val;
 }
 
 void VW::dense_parameters::set_zero(size_t offset)
 {
-  if (not_null())
+  if (not_null() && is_lazy())
+  {
+    // Writing zeros that are already there would commit untouched pages.
+    for (iterator iter = begin(); iter != end(); ++iter)
+    {
+      if ((&(*iter))[offset] != 0) { (&(*iter))[offset] = 0; }
+    }
+  }
+  else if (not_null())
   {
     for (iterator iter = begin(); iter != end(); ++iter) { (&(*iter))[offset] = 0; }
   }
@@ -84,6 +150,7 @@ void VW::dense_parameters::share(size_t length)
       shared_weights, [shared_weights, float_count](void*) { munmap(shared_weights, float_count); });
   memcpy(dest.get(), _begin.get(), float_count * sizeof(VW::weight));
   _begin = dest;
+  _lazy = false;
 }
 #  endif
 #endif
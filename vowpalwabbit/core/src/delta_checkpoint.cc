@@ -0,0 +1,352 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/delta_checkpoint.h"
+
+#include "vw/common/vw_exception.h"
+#include "vw/core/global_data.h"
+#include "vw/core/learner.h"
+#include "vw/core/parse_regressor.h"
+#include "vw/core/scope_exit.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+constexpr char RECORD_MARKER[4] = {'V', 'W', 'D', 'C'};
+constexpr uint32_t LOG_VERSION = 1;
+
+enum class record_kind : uint8_t
+{
+  FULL = 0,
+  DELTA = 1
+};
+
+class record_header
+{
+public:
+  record_kind kind = record_kind::FULL;
+  uint64_t weight_count = 0;
+  uint32_t stride_shift = 0;
+  uint64_t block_size = 0;
+};
+
+inline uint64_t rotl64(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+// 64 bit multiply-rotate hash of a block. A collision hides a changed block from the next checkpoint, so the 32 bit
+// hashes used elsewhere are not wide enough for the number of blocks in a large model.
+uint64_t hash_block(const VW::weight* data, uint64_t count)
+{
+  constexpr uint64_t PRIME_1 = 0x9E3779B185EBCA87ULL;
+  constexpr uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+  const char* bytes = reinterpret_cast<const char*>(data);
+  const size_t length = count * sizeof(VW::weight);
+
+  uint64_t h = PRIME_1 ^ length;
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t))
+  {
+    uint64_t word;
+    std::memcpy(&word, bytes + i, sizeof(word));
+    h = rotl64(h ^ (word * PRIME_2), 31) * PRIME_1;
+  }
+  if (i < length)
+  {
+    uint64_t word = 0;
+    std::memcpy(&word, bytes + i, length - i);
+    h = rotl64(h ^ (word * PRIME_2), 31) * PRIME_1;
+  }
+  h ^= h >> 33;
+  h *= PRIME_2;
+  h ^= h >> 29;
+  return h;
+}
+
+bool is_zero_block(const VW::weight* data, uint64_t count)
+{
+  return std::all_of(data, data + count, [](VW::weight w) { return w == 0.f; });
+}
+
+void write_record_header(VW::io_buf& log, const record_header& header)
+{
+  log.bin_write_fixed(RECORD_MARKER, sizeof(RECORD_MARKER));
+  log.write_value(LOG_VERSION);
+  log.write_value(static_cast<uint8_t>(header.kind));
+  log.write_value(header.weight_count);
+  log.write_value(header.stride_shift);
+  log.write_value(header.block_size);
+}
+
+// Returns false at the end of the log.
+bool read_record_header(VW::io_buf& log, record_header& header)
+{
+  char marker[sizeof(RECORD_MARKER)];
+  const auto read = log.bin_read_fixed(marker, sizeof(marker));
+  if (read == 0) { return false; }
+  if (read != sizeof(marker) || std::memcmp(marker, RECORD_MARKER, sizeof(marker)) != 0)
+  {
+    THROW("Delta checkpoint log is corrupt: expected a record marker.");
+  }
+
+  const auto version = log.read_value<uint32_t>("delta checkpoint version");
+  if (version != LOG_VERSION) { THROW("Unsupported delta checkpoint log version: " << version); }
+  const auto kind = log.read_value<uint8_t>("delta checkpoint record kind");
+  if (kind > static_cast<uint8_t>(record_kind::DELTA)) { THROW("Unknown delta checkpoint record kind: " << kind); }
+  header.kind = static_cast<record_kind>(kind);
+  header.weight_count = log.read_value<uint64_t>("delta checkpoint weight count");
+  header.stride_shift = log.read_value<uint32_t>("delta checkpoint stride shift");
+  header.block_size = log.read_value<uint64_t>("delta checkpoint block size");
+  if (header.block_size == 0 || header.weight_count % header.block_size != 0)
+  {
+    THROW("Delta checkpoint log is corrupt: block size " << header.block_size << " does not divide "
+                                                         << header.weight_count << " weights.");
+  }
+  return true;
+}
+
+void write_state(VW::io_buf& log, const std::vector<char>& state)
+{
+  log.write_value(static_cast<uint64_t>(state.size()));
+  log.bin_write_fixed(state.data(), state.size());
+}
+
+void read_state(VW::io_buf& log, std::vector<char>& state)
+{
+  const auto size = log.read_value<uint64_t>("delta checkpoint state size");
+  state.resize(size);
+  if (log.bin_read_fixed(state.data(), size) != size) { THROW("Delta checkpoint log is truncated."); }
+}
+
+// Calls block_func(block_index, block_data) for every block of the current record.
+template <typename BlockFuncT>
+void read_blocks(VW::io_buf& log, const record_header& header, BlockFuncT&& block_func)
+{
+  const auto count = log.read_value<uint64_t>("delta checkpoint block count");
+  const auto num_blocks = header.weight_count / header.block_size;
+  std::vector<VW::weight> block(header.block_size);
+  const size_t block_bytes = header.block_size * sizeof(VW::weight);
+  for (uint64_t i = 0; i < count; ++i)
+  {
+    const auto index = log.read_value<uint64_t>("delta checkpoint block index");
+    if (index >= num_blocks) { THROW("Delta checkpoint log is corrupt: block " << index << " is out of range."); }
+    if (log.bin_read_fixed(reinterpret_cast<char*>(block.data()), block_bytes) != block_bytes)
+    {
+      THROW("Delta checkpoint log is truncated.");
+    }
+    block_func(index, block.data());
+  }
+}
+
+void write_block(VW::io_buf& log, uint64_t index, const VW::weight* data, uint64_t block_size)
+{
+  log.write_value(index);
+  log.bin_write_fixed(reinterpret_cast<const char*>(data), block_size * sizeof(VW::weight));
+}
+
+void check_weights(VW::workspace& all)
+{
+  if (all.weights.sparse) { THROW("Delta checkpoints require dense weights, --sparse_weights is not supported."); }
+  if (!all.weights.not_null()) { THROW("Delta checkpoints require initialized weights."); }
+}
+}  // namespace
+
+constexpr uint64_t VW::delta_checkpoint_writer::DEFAULT_BLOCK_SIZE;
+
+VW::delta_checkpoint_writer::delta_checkpoint_writer(
+    VW::workspace& all, std::unique_ptr<VW::io::writer> log, bool start_from_current, uint64_t block_size)
+    : _all(all), _block_size(block_size), _next_is_full(!start_from_current)
+{
+  check_weights(all);
+  if (_block_size == 0 || (_block_size & (_block_size - 1)) != 0)
+  {
+    THROW("Delta checkpoint block size must be a power of two, got " << _block_size);
+  }
+
+  auto& weights = all.weights.dense_weights;
+  _block_size = std::min(_block_size, weights.raw_length());
+  _log.add_file(std::move(log));
+
+  const auto num_blocks = weights.raw_length() / _block_size;
+  if (start_from_current)
+  {
+    const VW::weight* data = weights.first();
+    _block_hashes.reserve(num_blocks);
+    for (uint64_t b = 0; b < num_blocks; ++b)
+    {
+      _block_hashes.push_back(hash_block(data + b * _block_size, _block_size));
+    }
+  }
+  else
+  {
+    // Everything which differs from zero goes into the first, full, record.
+    const std::vector<VW::weight> zero_block(_block_size, 0.f);
+    _block_hashes.assign(num_blocks, hash_block(zero_block.data(), _block_size));
+  }
+}
+
+void VW::delta_checkpoint_writer::checkpoint()
+{
+  auto state = std::make_shared<std::vector<char>>();
+  {
+    VW::io_buf state_buf;
+    state_buf.add_file(VW::io::create_vector_writer(state));
+    _all.runtime_state.skip_weights_save_load = true;
+    auto restore_guard = VW::scope_exit([this] { _all.runtime_state.skip_weights_save_load = false; });
+    VW::details::dump_regressor(_all, state_buf, false);
+  }
+
+  auto& weights = _all.weights.dense_weights;
+  const VW::weight* data = weights.first();
+  std::vector<uint64_t> changed_blocks;
+  for (uint64_t b = 0; b < _block_hashes.size(); ++b)
+  {
+    const auto hash = hash_block(data + b * _block_size, _block_size);
+    if (hash != _block_hashes[b])
+    {
+      changed_blocks.push_back(b);
+      _block_hashes[b] = hash;
+    }
+  }
+
+  record_header header;
+  header.kind = _next_is_full ? record_kind::FULL : record_kind::DELTA;
+  header.weight_count = weights.raw_length();
+  header.stride_shift = weights.stride_shift();
+  header.block_size = _block_size;
+  write_record_header(_log, header);
+  write_state(_log, *state);
+  _log.write_value(static_cast<uint64_t>(changed_blocks.size()));
+  for (auto b : changed_blocks) { write_block(_log, b, data + b * _block_size, _block_size); }
+  _log.flush();
+
+  _next_is_full = false;
+  _blocks_in_last_checkpoint = changed_blocks.size();
+  ++_checkpoints_written;
+}
+
+void VW::apply_delta_checkpoints(VW::workspace& all, std::unique_ptr<VW::io::reader> log)
+{
+  check_weights(all);
+  VW::io_buf log_buf;
+  log_buf.add_file(std::move(log));
+
+  auto& weights = all.weights.dense_weights;
+  VW::weight* data = weights.first();
+  std::vector<char> state;
+  record_header header;
+  bool any_record = false;
+  while (read_record_header(log_buf, header))
+  {
+    if (header.weight_count != weights.raw_length())
+    {
+      THROW("Delta checkpoint log was written for " << header.weight_count << " weights but the model has "
+                                                    << weights.raw_length());
+    }
+    read_state(log_buf, state);
+
+    if (header.kind == record_kind::FULL)
+    {
+      // Blocks a full record does not list are zero. Only clear the ones which are not, to avoid touching every page.
+      for (uint64_t start = 0; start < header.weight_count; start += header.block_size)
+      {
+        if (!is_zero_block(data + start, header.block_size))
+        {
+          std::memset(data + start, 0, header.block_size * sizeof(VW::weight));
+        }
+      }
+    }
+
+    read_blocks(log_buf, header,
+        [&](uint64_t index, const VW::weight* block)
+        { std::memcpy(data + index * header.block_size, block, header.block_size * sizeof(VW::weight)); });
+    any_record = true;
+  }
+  if (!any_record) { THROW("Delta checkpoint log is empty."); }
+
+  VW::io_buf state_buf;
+  state_buf.add_file(VW::io::create_buffer_view(state.data(), state.size()));
+  all.runtime_state.skip_weights_save_load = true;
+  auto restore_guard = VW::scope_exit([&all] { all.runtime_state.skip_weights_save_load = false; });
+  std::string unused_file_options;
+  VW::details::save_load_header(all, state_buf, true, false, unused_file_options, *all.options);
+  if (all.l != nullptr) { all.l->save_load(state_buf, true, false); }
+}
+
+std::vector<char> VW::read_delta_checkpoint_state(std::unique_ptr<VW::io::reader> log)
+{
+  VW::io_buf log_buf;
+  log_buf.add_file(std::move(log));
+
+  std::vector<char> state;
+  record_header header;
+  bool any_record = false;
+  while (read_record_header(log_buf, header))
+  {
+    read_state(log_buf, state);
+    read_blocks(log_buf, header, [](uint64_t, const VW::weight*) {});
+    any_record = true;
+  }
+  if (!any_record) { THROW("Delta checkpoint log is empty."); }
+  return state;
+}
+
+void VW::compact_delta_checkpoints(std::unique_ptr<VW::io::reader> log, std::unique_ptr<VW::io::writer> output)
+{
+  VW::io_buf log_buf;
+  log_buf.add_file(std::move(log));
+  if (!log_buf.is_resettable()) { THROW("Compacting a delta checkpoint log needs a resettable reader."); }
+
+  // First pass: find the record holding the latest content of every block. Blocks listed before the last full record
+  // are superseded by it.
+  std::unordered_map<uint64_t, uint64_t> latest_record_of_block;
+  std::vector<char> state;
+  record_header header;
+  record_header compacted_header;
+  uint64_t record = 0;
+  for (; read_record_header(log_buf, header); ++record)
+  {
+    if (record > 0 &&
+        (header.weight_count != compacted_header.weight_count || header.block_size != compacted_header.block_size))
+    {
+      THROW("Delta checkpoint log mixes records of different models, record " << record << " does not match.");
+    }
+    if (record == 0) { compacted_header = header; }
+    if (header.kind == record_kind::FULL)
+    {
+      latest_record_of_block.clear();
+      compacted_header.kind = record_kind::FULL;
+    }
+    compacted_header.stride_shift = header.stride_shift;
+    read_state(log_buf, state);
+    read_blocks(log_buf, header, [&](uint64_t index, const VW::weight*) { latest_record_of_block[index] = record; });
+  }
+  if (record == 0) { THROW("Delta checkpoint log is empty."); }
+
+  VW::io_buf output_buf;
+  output_buf.add_file(std::move(output));
+  write_record_header(output_buf, compacted_header);
+  write_state(output_buf, state);
+  output_buf.write_value(static_cast<uint64_t>(latest_record_of_block.size()));
+
+  // Second pass: copy each block from the record holding its latest content.
+  log_buf.reset();
+  std::vector<char> unused_state;
+  for (record = 0; read_record_header(log_buf, header); ++record)
+  {
+    read_state(log_buf, unused_state);
+    read_blocks(log_buf, header,
+        [&](uint64_t index, const VW::weight* block)
+        {
+          const auto it = latest_record_of_block.find(index);
+          if (it != latest_record_of_block.end() && it->second == record)
+          {
+            write_block(output_buf, index, block, header.block_size);
+          }
+        });
+  }
+  output_buf.flush();
+}
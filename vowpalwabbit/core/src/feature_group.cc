@@ -6,7 +6,12 @@
 
 #include "vw/core/v_array.h"
 
+#if defined(__AVX2__)
+#  include <immintrin.h>
+#endif
+
 #include <algorithm>
+#include <limits>
 #include <numeric>
 #include <utility>
 #include <vector>
@@ -298,27 +303,62 @@ void VW::features::end_ns_extent()
   }
 }
 
+namespace
+{
+#if defined(__AVX2__)
+// Number of the 4 sorted indices at p which are below bound. Indices are compared as unsigned by flipping their sign
+// bit, and since they are sorted the ones below bound are a prefix.
+inline size_t count_below4(const uint64_t* p, uint64_t bound)
+{
+  const __m256i sign = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min());
+  const __m256i values = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), sign);
+  const __m256i limit = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<int64_t>(bound)), sign);
+  const int mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(limit, values)));
+  return mask == 0xF ? 4 : mask == 0x7 ? 3 : mask == 0x3 ? 2 : static_cast<size_t>(mask);
+}
+#endif
+
+// Returns the first position from idx on whose index is not below bound, or size.
+inline size_t skip_below(const uint64_t* indices, size_t idx, size_t size, uint64_t bound)
+{
+#if defined(__AVX2__)
+  for (; idx + 4 <= size; idx += 4)
+  {
+    const size_t below = count_below4(indices + idx, bound);
+    if (below < 4) { return idx + below; }
+  }
+#endif
+  while (idx < size && indices[idx] < bound) { ++idx; }
+  return idx;
+}
+}  // namespace
+
 float VW::features_dot_product(const features& fs1, const features& fs2)
 {
   assert(std::is_sorted(fs1.indices.begin(), fs1.indices.end()));
   assert(std::is_sorted(fs2.indices.begin(), fs2.indices.end()));
 
+  // Runs of indices which only appear on one side are skipped 4 at a time. Matches are accumulated in index order,
+  // so the result does not depend on whether the vectorized skips are available.
   float dotprod = 0;
-  if (fs2.indices.empty()) { return 0.f; }
-
-  for (size_t idx1 = 0, idx2 = 0; idx1 < fs1.size() && idx2 < fs2.size(); idx1++)
+  const uint64_t* indices1 = fs1.indices.data();
+  const uint64_t* indices2 = fs2.indices.data();
+  const size_t size1 = fs1.size();
+  const size_t size2 = fs2.size();
+  size_t idx1 = 0;
+  size_t idx2 = 0;
+  while (idx1 < size1 && idx2 < size2)
   {
-    uint64_t ec1pos = fs1.indices[idx1];
-    uint64_t ec2pos = fs2.indices[idx2];
-    if (ec1pos < ec2pos) { continue; }
-
-    while (ec1pos > ec2pos && ++idx2 < fs2.size()) { ec2pos = fs2.indices[idx2]; }
-
-    if (ec1pos == ec2pos)
+    const uint64_t ec1pos = indices1[idx1];
+    const uint64_t ec2pos = indices2[idx2];
+    if (ec1pos < ec2pos) { idx1 = skip_below(indices1, idx1 + 1, size1, ec2pos); }
+    else if (ec1pos > ec2pos) { idx2 = skip_below(indices2, idx2 + 1, size2, ec1pos); }
+    else
     {
       dotprod += fs1.values[idx1] * fs2.values[idx2];
+      ++idx1;
       ++idx2;
     }
   }
   return dotprod;
-}
\ No newline at end of file
+}
@@ -17,12 +17,14 @@
 #include "vw/common/vw_exception.h"
 #include "vw/config/options.h"
 #include "vw/core/array_parameters.h"
+#include "vw/core/delta_checkpoint.h"
 #include "vw/core/kskip_ngram_transformer.h"
 #include "vw/core/learner.h"
 #include "vw/core/loss_functions.h"
 #include "vw/core/named_labels.h"
 #include "vw/core/parse_regressor.h"
 #include "vw/core/parser.h"
+#include "vw/core/prediction_writer.h"
 #include "vw/core/reduction_stack.h"
 #include "vw/core/reductions/metrics.h"
 #include "vw/core/shared_data.h"
@@ -53,6 +55,13 @@ void VW::details::print_result_by_ref(
 {
   if (f != nullptr)
   {
+    // Buffered sinks format on their own thread.
+    if (auto* async_writer = dynamic_cast<VW::async_prediction_writer*>(f))
+    {
+      async_writer->write_scalar(res, tag);
+      return;
+    }
+
     std::stringstream ss;
     auto saved_precision = ss.precision();
     if (floorf(res) == res) { ss << std::setprecision(0); }
@@ -360,6 +369,7 @@ workspace::workspace(VW::io::logger logger) : options(nullptr, nullptr), logger(
   initial_weights_config.random_weights = false;
   initial_weights_config.normal_weights = false;
   initial_weights_config.tnormal_weights = false;
+  initial_weights_config.lazy_weights = false;
   initial_weights_config.per_feature_regularizer_input = "";
   output_model_config.per_feature_regularizer_output = "";
   output_model_config.per_feature_regularizer_text = "";
@@ -419,6 +429,9 @@ void workspace::finish()
         passes_config.holdout_set_off);
   }
 
+  // Written before finalize_regressor, which may modify the weights when the final model drops the online state.
+  if (output_runtime.delta_checkpoints != nullptr) { output_runtime.delta_checkpoints->checkpoint(); }
+
   details::finalize_regressor(*this, output_model_config.final_regressor_name);
   if (options->was_supplied("dump_json_weights_experimental"))
   {
@@ -427,6 +440,11 @@ void workspace::finish()
     writer->write(content.c_str(), content.length());
   }
   VW::reductions::output_metrics(*this);
+
+  // Buffered prediction sinks write on their own thread, make sure everything is out before returning.
+  for (auto& sink : output_runtime.final_prediction_sink) { sink->flush(); }
+  if (output_runtime.raw_prediction != nullptr) { output_runtime.raw_prediction->flush(); }
+
   logger.log_summary();
 
   if (l != nullptr) { l->finish(); }
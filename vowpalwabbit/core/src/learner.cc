@@ -19,26 +19,42 @@
 
 #include "vw/core/vw_string_view_fmt.h"
 
+#include "vw/core/delta_checkpoint.h"
 #include "vw/core/parse_dispatch_loop.h"
 #include "vw/core/parse_regressor.h"
 #include "vw/core/parser.h"
 #include "vw/core/reductions/conditional_contextual_bandit.h"
+#include "vw/core/shared_data.h"
 #include "vw/core/vw.h"
 
 namespace VW
 {
 namespace LEARNER
 {
+namespace
+{
+void maybe_write_delta_checkpoint(VW::workspace& all)
+{
+  const auto period = all.output_model_config.delta_checkpoint_period;
+  if (period != 0 && all.output_runtime.delta_checkpoints != nullptr && all.sd->example_number % period == 0)
+  {
+    all.output_runtime.delta_checkpoints->checkpoint();
+  }
+}
+}  // namespace
+
 void learn_ex(example& ec, VW::workspace& all)
 {
   all.learn(ec);
   require_singleline(all.l)->finish_example(all, ec);
+  maybe_write_delta_checkpoint(all);
 }
 
 void learn_multi_ex(multi_ex& ec_seq, VW::workspace& all)
 {
   all.learn(ec_seq);
   require_multiline(all.l)->finish_example(all, ec_seq);
+  maybe_write_delta_checkpoint(all);
 }
 
 void end_pass(example& ec, VW::workspace& all)
@@ -18,6 +18,8 @@
 
 #include <algorithm>
 #include <limits>
+#include <string>
+#include <vector>
 
 namespace
 {
@@ -32,6 +34,16 @@ std::string get_keep_command_line(const VW::workspace& workspace)
   return serializer.str();
 }
 
+// The number of bits is stored in the model header rather than in the kept options, so a destination workspace has to
+// be given it explicitly to hold the weights of the models it merges.
+std::vector<std::string> get_destination_command_line(const VW::workspace& workspace)
+{
+  auto command_line = VW::split_command_line(get_keep_command_line(workspace));
+  command_line.emplace_back("--bit_precision");
+  command_line.emplace_back(std::to_string(workspace.initial_weights_config.num_bits));
+  return command_line;
+}
+
 void validate_compatibility(const std::vector<const VW::workspace*>& workspaces, VW::io::logger* logger)
 {
   if (workspaces.size() < 2) { THROW("Must specify at least two model files to merge."); }
@@ -91,22 +103,6 @@ void validate_compatibility(const std::vector<const VW::workspace*>& workspaces,
   }
 }
 
-std::unique_ptr<VW::workspace> copy_workspace(const VW::workspace* ws, VW::io::logger* logger = nullptr)
-{
-  assert(ws != nullptr);
-  auto command_line = VW::split_command_line(get_keep_command_line(*ws));
-  if (logger == nullptr) { command_line.emplace_back("--quiet"); }
-  else { command_line.emplace_back("--driver_output_off"); }
-  command_line.emplace_back("--preserve_performance_counters");
-
-  auto backing_vector = std::make_shared<std::vector<char>>();
-  VW::io_buf temp_buffer;
-  temp_buffer.add_file(VW::io::create_vector_writer(backing_vector));
-  VW::save_predictor(*const_cast<VW::workspace*>(ws), temp_buffer);
-  return VW::initialize(VW::make_unique<VW::config::options_cli>(command_line),
-      VW::io::create_buffer_view(backing_vector->data(), backing_vector->size()), nullptr, nullptr, logger);
-}
-
 std::vector<float> calc_per_model_weighting(const std::vector<float>& example_counts)
 {
   const auto sum = std::accumulate(example_counts.begin(), example_counts.end(), 0.f);
@@ -161,21 +157,22 @@ std::unique_ptr<model_delta> model_delta::deserialize(VW::io::reader& input)
       VW::make_unique<VW::config::options_cli>(command_line), VW::make_unique<reader_ref_adapter>(input)));
 }
 
-VW::model_delta merge_deltas(const std::vector<const VW::model_delta*>& deltas_to_merge, VW::io::logger* logger)
+namespace
+{
+// Merges into a new workspace without taking ownership of, or copying, the given workspaces.
+std::unique_ptr<VW::workspace> merge_workspaces(
+    const std::vector<const VW::workspace*>& workspaces_to_merge, VW::io::logger* logger, size_t num_threads)
 {
-  // Get workspace pointers from deltas
-  std::vector<const VW::workspace*> workspaces_to_merge;
-  workspaces_to_merge.reserve(deltas_to_merge.size());
-  for (const auto delta_ptr : deltas_to_merge) { workspaces_to_merge.push_back(delta_ptr->unsafe_get_workspace_ptr()); }
   validate_compatibility(workspaces_to_merge, logger);
 
   // Get VW command line and create output workspace
-  auto command_line = VW::split_command_line(get_keep_command_line(*workspaces_to_merge[0]));
+  auto command_line = get_destination_command_line(*workspaces_to_merge[0]);
   if (logger == nullptr) { command_line.emplace_back("--quiet"); }
   else { command_line.emplace_back("--driver_output_off"); }
   command_line.emplace_back("--preserve_performance_counters");
   auto dest_workspace =
       VW::initialize(VW::make_unique<VW::config::options_cli>(command_line), nullptr, nullptr, nullptr, logger);
+  dest_workspace->runtime_state.merge_threads = num_threads;
 
   // Get example counts and compute weighting of models
   std::vector<float> example_counts;
@@ -235,35 +232,35 @@ VW::model_delta merge_deltas(const std::vector<const VW::model_delta*>& deltas_t
     dest_workspace->sd->min_label = std::min(dest_workspace->sd->min_label, delta->sd->min_label);
   }
 
-  return VW::model_delta(std::move(dest_workspace));
+  return dest_workspace;
+}
+}  // namespace
+
+VW::model_delta merge_deltas(
+    const std::vector<const VW::model_delta*>& deltas_to_merge, VW::io::logger* logger, size_t num_threads)
+{
+  // Get workspace pointers from deltas
+  std::vector<const VW::workspace*> workspaces_to_merge;
+  workspaces_to_merge.reserve(deltas_to_merge.size());
+  for (const auto delta_ptr : deltas_to_merge) { workspaces_to_merge.push_back(delta_ptr->unsafe_get_workspace_ptr()); }
+  return VW::model_delta(merge_workspaces(workspaces_to_merge, logger, num_threads));
 }
 
 std::unique_ptr<VW::workspace> merge_models(const VW::workspace* base_workspace,
-    const std::vector<const VW::workspace*>& workspaces_to_merge, VW::io::logger* logger)
+    const std::vector<const VW::workspace*>& workspaces_to_merge, VW::io::logger* logger, size_t num_threads)
 {
+  // Without a base the models are their own deltas and are merged in place rather than copied first.
+  if (base_workspace == nullptr) { return merge_workspaces(workspaces_to_merge, logger, num_threads); }
+
   std::vector<VW::model_delta> deltas;
   deltas.reserve(workspaces_to_merge.size());
-
-  if (base_workspace != nullptr)
-  {
-    for (const auto* ws : workspaces_to_merge) { deltas.emplace_back(*ws - *base_workspace); }
-  }
-  else
-  {
-    for (const auto* ws : workspaces_to_merge)
-    {
-      // No base workspace to subtract, but we must make a copy of workspace to give delta ownership of it
-      deltas.emplace_back(copy_workspace(ws, logger));
-    }
-  }
+  for (const auto* ws : workspaces_to_merge) { deltas.emplace_back(*ws - *base_workspace); }
 
   std::vector<const VW::model_delta*> delta_ptrs;
   delta_ptrs.reserve(deltas.size());
   for (const auto& d : deltas) { delta_ptrs.push_back(&d); }
-  VW::model_delta merged = merge_deltas(delta_ptrs, logger);
-
-  if (base_workspace != nullptr) { return *base_workspace + merged; }
-  return std::unique_ptr<VW::workspace>(merged.unsafe_release_workspace_ptr());
+  VW::model_delta merged = merge_deltas(delta_ptrs, logger, num_threads);
+  return *base_workspace + merged;
 }
 }  // namespace VW
 
@@ -271,7 +268,7 @@ std::unique_ptr<VW::workspace> VW::operator+(const VW::workspace& base, const VW
 {
   const VW::workspace* delta = md.unsafe_get_workspace_ptr();
   validate_compatibility(std::vector<const VW::workspace*>{&base, delta}, nullptr);
-  auto dest_command_line = VW::split_command_line(get_keep_command_line(base));
+  auto dest_command_line = get_destination_command_line(base);
   dest_command_line.emplace_back("--quiet");
   dest_command_line.emplace_back("--preserve_performance_counters");
 
@@ -321,7 +318,7 @@ std::unique_ptr<VW::workspace> VW::operator+(const VW::workspace& base, const VW
 VW::model_delta VW::operator-(const VW::workspace& ws1, const VW::workspace& ws2)
 {
   validate_compatibility(std::vector<const VW::workspace*>{&ws1, &ws2}, nullptr);
-  auto dest_command_line = VW::split_command_line(get_keep_command_line(ws1));
+  auto dest_command_line = get_destination_command_line(ws1);
   dest_command_line.emplace_back("--quiet");
   dest_command_line.emplace_back("--preserve_performance_counters");
 
@@ -16,6 +16,7 @@
 #include "vw/core/best_constant.h"
 #include "vw/core/constant.h"
 #include "vw/core/crossplat_compat.h"
+#include "vw/core/delta_checkpoint.h"
 #include "vw/core/global_data.h"
 #include "vw/core/interactions.h"
 #include "vw/core/kskip_ngram_transformer.h"
@@ -30,6 +31,7 @@
 #include "vw/core/parse_regressor.h"
 #include "vw/core/parser.h"
 #include "vw/core/prediction_type.h"
+#include "vw/core/prediction_writer.h"
 #include "vw/core/reduction_stack.h"
 #include "vw/core/reductions/metrics.h"
 #include "vw/core/scope_exit.h"
@@ -1238,27 +1240,47 @@ void parse_output_preds(options_i& options, VW::workspace& all)
 {
   std::string predictions;
   std::string raw_predictions;
+  bool async_prediction_output = false;
+  std::string prediction_output_format;
 
   option_group_definition output_options("Prediction Output");
   output_options.add(make_option("predictions", predictions).short_name("p").help("File to output predictions to"))
       .add(make_option("raw_predictions", raw_predictions)
                .short_name("r")
-               .help("File to output unnormalized predictions to"));
+               .help("File to output unnormalized predictions to"))
+      .add(make_option("async_prediction_output", async_prediction_output)
+               .experimental()
+               .help("Stage predictions in memory and format and write them on a background thread"))
+      .add(make_option("prediction_output_format", prediction_output_format)
+               .default_value("text")
+               .one_of({"text", "binary"})
+               .experimental()
+               .help("Format of prediction output. 'binary' writes length prefixed records of float32 values and tags "
+                     "and implies --async_prediction_output"));
   options.add_and_parse(output_options);
 
+  const auto format = prediction_output_format == "binary" ? VW::prediction_output_format::BINARY
+                                                           : VW::prediction_output_format::TEXT;
+  const bool buffered = async_prediction_output || format == VW::prediction_output_format::BINARY;
+  auto wrap_sink = [&](std::unique_ptr<VW::io::writer> sink) -> std::unique_ptr<VW::io::writer>
+  {
+    if (!buffered) { return sink; }
+    return VW::make_unique<VW::async_prediction_writer>(std::move(sink), format, all.logger);
+  };
+
   if (options.was_supplied("predictions"))
   {
     if (!all.output_config.quiet) { *(all.output_runtime.trace_message) << "predictions = " << predictions << endl; }
 
     if (predictions == "stdout")
     {
-      all.output_runtime.final_prediction_sink.push_back(VW::io::open_stdout());  // stdout
+      all.output_runtime.final_prediction_sink.push_back(wrap_sink(VW::io::open_stdout()));  // stdout
     }
     else
     {
       try
       {
-        all.output_runtime.final_prediction_sink.push_back(VW::io::open_file_writer(predictions));
+        all.output_runtime.final_prediction_sink.push_back(wrap_sink(VW::io::open_file_writer(predictions)));
       }
       catch (...)
       {
@@ -1277,8 +1299,8 @@ void parse_output_preds(options_i& options, VW::workspace& all)
         all.logger.err_warn("--raw_predictions has no defined value when --binary specified, expect no output");
       }
     }
-    if (raw_predictions == "stdout") { all.output_runtime.raw_prediction = VW::io::open_stdout(); }
-    else { all.output_runtime.raw_prediction = VW::io::open_file_writer(raw_predictions); }
+    if (raw_predictions == "stdout") { all.output_runtime.raw_prediction = wrap_sink(VW::io::open_stdout()); }
+    else { all.output_runtime.raw_prediction = wrap_sink(VW::io::open_file_writer(raw_predictions)); }
   }
 }
 
@@ -1324,9 +1346,22 @@ void parse_output_model(options_i& options, VW::workspace& all)
                .help("Per feature regularization output file"))
       .add(make_option("output_feature_regularizer_text", all.output_model_config.per_feature_regularizer_text)
                .help("Per feature regularization output file, in text"))
-      .add(make_option("id", all.id).help("User supplied ID embedded into the final regressor"));
+      .add(make_option("id", all.id).help("User supplied ID embedded into the final regressor"))
+      .add(make_option("delta_checkpoint", all.output_model_config.delta_checkpoint_log)
+               .experimental()
+               .help("Append checkpoints holding only the blocks of weights which changed since the previous "
+                     "checkpoint to this log. Replay or compact it with vw-checkpoint"))
+      .add(make_option("delta_checkpoint_period", all.output_model_config.delta_checkpoint_period)
+               .default_value(0)
+               .experimental()
+               .help("Write a delta checkpoint every this many examples. 0 only writes one when learning finishes"));
   options.add_and_parse(output_model_options);
 
+  if (options.was_supplied("delta_checkpoint_period") && !options.was_supplied("delta_checkpoint"))
+  {
+    THROW("--delta_checkpoint_period requires --delta_checkpoint");
+  }
+
   if (!all.output_model_config.final_regressor_name.empty() && !all.output_config.quiet)
   {
     *(all.output_runtime.trace_message) << "final_regressor = " << all.output_model_config.final_regressor_name << endl;
@@ -1528,10 +1563,33 @@ std::unique_ptr<VW::workspace> VW::details::parse_args(std::unique_ptr<options_i
       .add(make_option("truncated_normal_weights", all->initial_weights_config.tnormal_weights)
                .help("Make initial weights truncated normal"))
       .add(make_option("sparse_weights", all->weights.sparse).help("Use a sparse datastructure for weights"))
+      .add(make_option("lazy_weights", all->initial_weights_config.lazy_weights)
+               .experimental()
+               .help("Reserve the dense weight array and commit it page by page on first write. Non-zero initial "
+                     "weights are written when the array is allocated"))
       .add(make_option("input_feature_regularizer", all->initial_weights_config.per_feature_regularizer_input)
                .help("Per feature regularization input file"));
   all->options->add_and_parse(weight_args);
 
+  if (all->initial_weights_config.lazy_weights)
+  {
+    if (all->weights.sparse)
+    {
+      all->logger.err_warn("--lazy_weights has no effect with --sparse_weights");
+      all->initial_weights_config.lazy_weights = false;
+    }
+    // Truncation needs the statistics of every weight, which defeats lazy initialization.
+    if (all->initial_weights_config.tnormal_weights)
+    {
+      THROW("--lazy_weights cannot be used with --truncated_normal_weights");
+    }
+    // The random initializers draw from the shared random state, every weight has to be drawn in order.
+    if (all->initial_weights_config.random_weights || all->initial_weights_config.random_positive_weights)
+    {
+      THROW("--lazy_weights cannot be used with --random_weights or --random_positive_weights");
+    }
+  }
+
   std::string span_server_arg;
   int32_t span_server_port_arg;
   // bool threads_arg;
@@ -1708,9 +1766,17 @@ void VW::details::instantiate_learner(VW::workspace& all, std::unique_ptr<VW::se
 
 void VW::details::parse_sources(options_i& options, VW::workspace& all, VW::io_buf& model, bool skip_model_load)
 {
+  const bool model_loaded = !skip_model_load && model.num_input_files() > 0;
   if (!skip_model_load) { load_input_model(all, model); }
   else { model.close_file(); }
 
+  if (!all.output_model_config.delta_checkpoint_log.empty() && all.weights.not_null())
+  {
+    // A log continued from a loaded model only records what changes from it, otherwise it starts with a full record.
+    all.output_runtime.delta_checkpoints = VW::make_unique<VW::delta_checkpoint_writer>(
+        all, VW::io::open_file_append_writer(all.output_model_config.delta_checkpoint_log), model_loaded);
+  }
+
   auto parsed_source_options = parse_source(all, options);
   enable_sources(all, all.output_config.quiet, all.runtime_config.numpasses, parsed_source_options);
 
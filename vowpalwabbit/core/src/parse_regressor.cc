@@ -69,6 +69,22 @@ void truncate(VW::workspace& all, T& weights)
       });
 }
 
+void allocate_weights(VW::workspace& /* all */, VW::sparse_parameters& weights, size_t length, uint32_t stride_shift)
+{
+  weights.~sparse_parameters();  // dealloc so that we can realloc, now with a known size
+  new (&weights) VW::sparse_parameters(length, stride_shift);
+}
+
+void allocate_weights(VW::workspace& all, VW::dense_parameters& weights, size_t length, uint32_t stride_shift)
+{
+  weights.~dense_parameters();  // dealloc so that we can realloc, now with a known size
+  if (all.initial_weights_config.lazy_weights)
+  {
+    new (&weights) VW::dense_parameters(VW::dense_parameters::lazy_allocate(length, stride_shift));
+  }
+  else { new (&weights) VW::dense_parameters(length, stride_shift); }
+}
+
 template <class T>
 void initialize_regressor(VW::workspace& all, T& weights)
 {
@@ -78,9 +94,7 @@ void initialize_regressor(VW::workspace& all, T& weights)
   size_t length = (static_cast<size_t>(1)) << all.initial_weights_config.num_bits;
   try
   {
-    uint32_t ss = weights.stride_shift();
-    weights.~T();  // dealloc so that we can realloc, now with a known size
-    new (&weights) T(length, ss);
+    allocate_weights(all, weights, length, weights.stride_shift());
   }
   catch (const VW::vw_exception&)
   {
@@ -120,6 +134,8 @@ void initialize_regressor(VW::workspace& all, T& weights)
 
 void VW::details::initialize_regressor(VW::workspace& all)
 {
+  // Loading the state of a delta checkpoint keeps the weights which were replayed from the log.
+  if (all.runtime_state.skip_weights_save_load && all.weights.not_null()) { return; }
   if (all.weights.sparse) { ::initialize_regressor(all, all.weights.sparse_weights); }
   else { ::initialize_regressor(all, all.weights.dense_weights); }
 }
@@ -0,0 +1,191 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/prediction_writer.h"
+
+#include "vw/common/vw_exception.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+template <typename T>
+void append_value(std::vector<char>& buffer, const T& value)
+{
+  const auto* bytes = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+T read_value(const char*& cursor)
+{
+  T value;
+  std::memcpy(&value, cursor, sizeof(T));
+  cursor += sizeof(T);
+  return value;
+}
+}  // namespace
+
+constexpr uint8_t VW::async_prediction_writer::SCALAR_RECORD;
+constexpr uint8_t VW::async_prediction_writer::TEXT_RECORD;
+
+VW::async_prediction_writer::async_prediction_writer(std::unique_ptr<VW::io::writer> inner,
+    prediction_output_format format, VW::io::logger logger, size_t buffer_size, size_t num_buffers)
+    : _inner(std::move(inner))
+    , _format(format)
+    , _logger(std::move(logger))
+    , _buffer_size(buffer_size)
+    , _free(num_buffers)
+    , _filled(num_buffers)
+{
+  if (num_buffers < 2) { THROW("async_prediction_writer needs at least two buffers"); }
+  _current.reserve(_buffer_size);
+  for (size_t i = 1; i < num_buffers; ++i)
+  {
+    std::vector<char> buffer;
+    buffer.reserve(_buffer_size);
+    _free.push(std::move(buffer));
+  }
+  _worker = std::thread([this]() { drain(); });
+}
+
+VW::async_prediction_writer::~async_prediction_writer()
+{
+  if (!_current.empty())
+  {
+    {
+      std::lock_guard<std::mutex> lock(_written_mutex);
+      ++_submitted;
+    }
+    _filled.push(std::move(_current));
+  }
+  _filled.set_done();
+  _worker.join();
+  try
+  {
+    _inner->flush();
+  }
+  catch (...)
+  {
+    ++_failed_writes;
+  }
+  report_errors();
+}
+
+ssize_t VW::async_prediction_writer::write(const char* buffer, size_t num_bytes)
+{
+  _current.push_back(static_cast<char>(TEXT_RECORD));
+  append_value(_current, static_cast<uint32_t>(num_bytes));
+  _current.insert(_current.end(), buffer, buffer + num_bytes);
+  if (_current.size() >= _buffer_size) { submit_current(); }
+  return static_cast<ssize_t>(num_bytes);
+}
+
+void VW::async_prediction_writer::write_scalar(float value, const VW::v_array<char>& tag)
+{
+  _current.push_back(static_cast<char>(SCALAR_RECORD));
+  append_value(_current, value);
+  append_value(_current, static_cast<uint32_t>(tag.size()));
+  _current.insert(_current.end(), tag.begin(), tag.end());
+  if (_current.size() >= _buffer_size) { submit_current(); }
+}
+
+void VW::async_prediction_writer::flush()
+{
+  if (!_current.empty()) { submit_current(); }
+  {
+    std::unique_lock<std::mutex> lock(_written_mutex);
+    _written_cv.wait(lock, [this]() { return _written == _submitted; });
+  }
+  _inner->flush();
+  report_errors();
+}
+
+void VW::async_prediction_writer::submit_current()
+{
+  {
+    std::lock_guard<std::mutex> lock(_written_mutex);
+    ++_submitted;
+  }
+  _filled.push(std::move(_current));
+  // Blocks when the writer thread is behind by a whole ring, which bounds the memory used for staging.
+  _free.try_pop(_current);
+}
+
+void VW::async_prediction_writer::drain()
+{
+  std::vector<char> staged;
+  while (_filled.try_pop(staged))
+  {
+    try
+    {
+      write_out(staged);
+    }
+    catch (...)
+    {
+      ++_failed_writes;
+    }
+    staged.clear();
+    _free.push(std::move(staged));
+    {
+      std::lock_guard<std::mutex> lock(_written_mutex);
+      ++_written;
+    }
+    _written_cv.notify_all();
+  }
+}
+
+void VW::async_prediction_writer::write_out(const std::vector<char>& staged)
+{
+  const char* data = staged.data();
+  size_t len = staged.size();
+
+  // Records are staged in the binary layout, so only the text format needs any work here.
+  if (_format == prediction_output_format::TEXT)
+  {
+    _formatted.clear();
+    const char* cursor = staged.data();
+    const char* end = cursor + staged.size();
+    char number[64];
+    while (cursor < end)
+    {
+      const auto kind = static_cast<uint8_t>(*cursor++);
+      if (kind == SCALAR_RECORD)
+      {
+        const auto value = read_value<float>(cursor);
+        const auto tag_len = read_value<uint32_t>(cursor);
+        // Matches the stream formatting of print_result_by_ref: fixed, with no decimals for integral values.
+        int written = std::snprintf(
+            number, sizeof(number), std::floor(value) == value ? "%.0f" : "%.6f", static_cast<double>(value));
+        if (written > 0) { _formatted.insert(_formatted.end(), number, number + written); }
+        if (tag_len > 0)
+        {
+          _formatted.push_back(' ');
+          _formatted.insert(_formatted.end(), cursor, cursor + tag_len);
+        }
+        _formatted.push_back('\n');
+        cursor += tag_len;
+      }
+      else
+      {
+        const auto text_len = read_value<uint32_t>(cursor);
+        _formatted.insert(_formatted.end(), cursor, cursor + text_len);
+        cursor += text_len;
+      }
+    }
+    data = _formatted.data();
+    len = _formatted.size();
+  }
+
+  if (len == 0) { return; }
+  if (_inner->write(data, len) != static_cast<ssize_t>(len)) { ++_failed_writes; }
+}
+
+void VW::async_prediction_writer::report_errors()
+{
+  const auto failed = _failed_writes.exchange(0);
+  if (failed > 0) { _logger.err_error("write error: {} buffered prediction writes failed", failed); }
+}
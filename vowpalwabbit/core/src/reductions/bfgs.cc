@@ -19,9 +19,12 @@ Implementation by Miro Dudik.
 #include "vw/core/setup_base.h"
 #include "vw/core/shared_data.h"
 #include "vw/core/simple_label.h"
+#include "vw/core/thread_pool.h"
 
 #include <sys/timeb.h>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cfloat>
 #include <chrono>
@@ -30,6 +33,9 @@ Implementation by Miro Dudik.
 #include <cstring>
 #include <exception>
 #include <fstream>
+#include <future>
+#include <memory>
+#include <vector>
 
 #ifndef _WIN32
 #  include <netdb.h>
@@ -70,6 +76,17 @@ class curv_exception : public std::exception
 // w[3] = preconditioner
 
 constexpr float MAX_PRECOND_RATIO = 10000.f;
+// Number of staged feature updates after which they are applied, bounds the memory used for staging.
+constexpr size_t MAX_STAGED_UPDATES = 1 << 20;
+
+// Gradient and preconditioner contributions of one feature, waiting to be applied to the row at offset.
+class staged_update
+{
+public:
+  uint64_t offset;
+  float gradient;
+  float preconditioner;
+};
 
 class bfgs
 {
@@ -119,6 +136,11 @@ public:
   bool gradient_pass = false;
   bool preconditioner_pass = false;
 
+  // --bfgs_threads: passes over the weight vector are split across the pool and gradients are staged per example.
+  size_t num_threads = 1;
+  std::unique_ptr<VW::thread_pool> thread_pool;
+  std::vector<staged_update> staged_updates;
+
   ~bfgs()
   {
     free(mem);
@@ -180,6 +202,15 @@ float predict_and_gradient(VW::workspace& all, VW::example& ec)
   return fp;
 }
 
+class staging_data
+{
+public:
+  bfgs* b = nullptr;
+  uint64_t mask = 0;
+  float loss_grad = 0.f;
+  float curvature = 0.f;
+};
+
 inline void add_precond(float& d, float f, float& fw) { (&fw)[W_COND] += d * f * f; }
 
 void update_preconditioner(VW::workspace& all, VW::example& ec)
@@ -199,26 +230,135 @@ float dot_with_direction(VW::workspace& all, VW::example& ec)
   return temp;
 }
 
-template <class T>
-double regularizer_direction_magnitude(VW::workspace& /* all */, bfgs& b, double regularizer, T& weights)
+using range_sums = std::array<double, 4>;
+
+// Runs kernel(first, last, sums) over the whole weight vector. With --bfgs_threads, dense weights are split into one
+// contiguous range of rows per thread. The sums of each range are returned in range order and reduced by the caller
+// in that order, so results only depend on the number of threads and not on scheduling.
+template <class KernelT>
+std::vector<range_sums> for_each_range(bfgs& /* b */, VW::sparse_parameters& weights, KernelT&& kernel)
 {
-  double ret = 0.;
-  if (b.regularizers == nullptr)
+  std::vector<range_sums> partials(1, range_sums{});
+  kernel(weights.begin(), weights.end(), partials[0]);
+  return partials;
+}
+
+template <class KernelT>
+std::vector<range_sums> for_each_range(bfgs& b, VW::dense_parameters& weights, KernelT&& kernel)
+{
+  const size_t num_ranges = b.thread_pool == nullptr ? 1 : b.num_threads;
+  std::vector<range_sums> partials(num_ranges, range_sums{});
+  if (num_ranges == 1)
   {
-    for (typename T::iterator iter = weights.begin(); iter != weights.end(); ++iter)
-    {
-      ret += regularizer * (&(*iter))[W_DIR] * (&(*iter))[W_DIR];
-    }
+    kernel(weights.begin(), weights.end(), partials[0]);
+    return partials;
   }
-  else
+
+  const size_t num_rows = weights.raw_length() >> weights.stride_shift();
+  std::vector<std::future<void>> futures;
+  futures.reserve(num_ranges);
+  for (size_t r = 0; r < num_ranges; ++r)
   {
-    for (typename T::iterator iter = weights.begin(); iter != weights.end(); ++iter)
-    {
-      ret += ((double)b.regularizers[2 * (iter.index() >> weights.stride_shift())]) * (&(*iter))[W_DIR] *
-          (&(*iter))[W_DIR];
-    }
+    auto first = weights.begin();
+    first += num_rows * r / num_ranges;
+    auto last = weights.begin();
+    last += num_rows * (r + 1) / num_ranges;
+    range_sums* sums = &partials[r];
+    futures.push_back(b.thread_pool->submit([&kernel, first, last, sums]() { kernel(first, last, *sums); }));
   }
-  return ret;
+  for (auto& f : futures) { f.get(); }
+  return partials;
+}
+
+range_sums add_ranges(const std::vector<range_sums>& partials)
+{
+  range_sums total{};
+  for (const auto& partial : partials)
+  {
+    for (size_t i = 0; i < total.size(); ++i) { total[i] += partial[i]; }
+  }
+  return total;
+}
+
+inline void stage_update(staging_data& d, float f, uint64_t index)
+{
+  d.b->staged_updates.push_back({index & d.mask, d.loss_grad * f, d.curvature * f * f});
+}
+
+// Applies the gradient and preconditioner contributions staged by predict_and_stage_gradient. Each thread owns a
+// range of rows and applies the updates to it in example order, so the result is the same as the sequential update.
+void apply_staged_updates(bfgs& b, VW::dense_parameters& weights)
+{
+  if (b.staged_updates.empty()) { return; }
+
+  const bool with_preconditioner = b.preconditioner_pass;
+  for_each_range(b, weights,
+      [&](VW::dense_parameters::iterator first, VW::dense_parameters::iterator last, range_sums&)
+      {
+        VW::weight* data = &(*first);
+        const uint64_t begin_offset = first.index();
+        const uint64_t end_offset = last.index();
+        for (const auto& u : b.staged_updates)
+        {
+          if (u.offset < begin_offset || u.offset >= end_offset) { continue; }
+          VW::weight* w = data + (u.offset - begin_offset);
+          w[W_GT] += u.gradient;
+          if (with_preconditioner) { w[W_COND] += u.preconditioner; }
+        }
+      });
+  b.staged_updates.clear();
+}
+
+void apply_staged_updates(VW::workspace& all, bfgs& b)
+{
+  if (!all.weights.sparse) { apply_staged_updates(b, all.weights.dense_weights); }
+}
+
+// Same as predict_and_gradient followed by update_preconditioner, except that the weight updates are only staged and
+// applied later by all threads at once.
+float predict_and_stage_gradient(VW::workspace& all, bfgs& b, VW::example& ec)
+{
+  float fp = bfgs_predict(all, ec);
+  auto& ld = ec.l.simple;
+  if (all.set_minmax) { all.set_minmax(ld.label); }
+
+  staging_data d;
+  d.b = &b;
+  d.mask = all.weights.dense_weights.mask();
+  d.loss_grad = all.loss_config.loss->first_derivative(all.sd.get(), fp, ld.label) * ec.weight;
+  d.curvature =
+      b.preconditioner_pass ? all.loss_config.loss->second_derivative(all.sd.get(), fp, ld.label) * ec.weight : 0.f;
+  VW::foreach_feature<staging_data, uint64_t, stage_update>(all, ec, d);
+
+  if (b.staged_updates.size() >= MAX_STAGED_UPDATES) { apply_staged_updates(b, all.weights.dense_weights); }
+  return fp;
+}
+
+template <class T>
+double regularizer_direction_magnitude(VW::workspace& /* all */, bfgs& b, double regularizer, T& weights)
+{
+  auto partials = for_each_range(b, weights,
+      [&](typename T::iterator first, typename T::iterator last, range_sums& sums)
+      {
+        double ret = 0.;
+        if (b.regularizers == nullptr)
+        {
+          for (typename T::iterator iter = first; iter != last; ++iter)
+          {
+            ret += regularizer * (&(*iter))[W_DIR] * (&(*iter))[W_DIR];
+          }
+        }
+        else
+        {
+          for (typename T::iterator iter = first; iter != last; ++iter)
+          {
+            ret += ((double)b.regularizers[2 * (iter.index() >> weights.stride_shift())]) * (&(*iter))[W_DIR] *
+                (&(*iter))[W_DIR];
+          }
+        }
+        sums[0] = ret;
+      });
+  return add_ranges(partials)[0];
 }
 
 double regularizer_direction_magnitude(VW::workspace& all, bfgs& b, float regularizer)
@@ -233,43 +373,57 @@ double regularizer_direction_magnitude(VW::workspace& all, bfgs& b, float regula
 }
 
 template <class T>
-float direction_magnitude(VW::workspace& /* all */, T& weights)
+float direction_magnitude(VW::workspace& /* all */, bfgs& b, T& weights)
 {
   // compute direction magnitude
-  double ret = 0.;
-  for (typename T::iterator iter = weights.begin(); iter != weights.end(); ++iter)
-  {
-    ret += ((double)(&(*iter))[W_DIR]) * (&(*iter))[W_DIR];
-  }
+  auto partials = for_each_range(b, weights,
+      [](typename T::iterator first, typename T::iterator last, range_sums& sums)
+      {
+        double ret = 0.;
+        for (typename T::iterator iter = first; iter != last; ++iter)
+        {
+          ret += ((double)(&(*iter))[W_DIR]) * (&(*iter))[W_DIR];
+        }
+        sums[0] = ret;
+      });
 
-  return static_cast<float>(ret);
+  return static_cast<float>(add_ranges(partials)[0]);
 }
 
-float direction_magnitude(VW::workspace& all)
+float direction_magnitude(VW::workspace& all, bfgs& b)
 {
   // compute direction magnitude
-  if (all.weights.sparse) { return direction_magnitude(all, all.weights.sparse_weights); }
-  else { return direction_magnitude(all, all.weights.dense_weights); }
+  if (all.weights.sparse) { return direction_magnitude(all, b, all.weights.sparse_weights); }
+  else { return direction_magnitude(all, b, all.weights.dense_weights); }
 }
 
 template <class T>
 void bfgs_iter_start(
     VW::workspace& all, bfgs& b, float* mem, int& lastj, double importance_weight_sum, int& origin, T& weights)
 {
-  double g1_Hg1 = 0.;  // NOLINT
-  double g1_g1 = 0.;
-
   origin = 0;
-  for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-  {
-    float* mem1 = mem + (w.index() >> weights.stride_shift()) * b.mem_stride;
-    if (b.m > 0) { mem1[(MEM_XT + origin) % b.mem_stride] = (&(*w))[W_XT]; }
-    mem1[(MEM_GT + origin) % b.mem_stride] = (&(*w))[W_GT];
-    g1_Hg1 += ((double)(&(*w))[W_GT]) * ((&(*w))[W_GT]) * ((&(*w))[W_COND]);
-    g1_g1 += ((double)((&(*w))[W_GT])) * ((&(*w))[W_GT]);
-    (&(*w))[W_DIR] = -(&(*w))[W_COND] * ((&(*w))[W_GT]);
-    ((&(*w))[W_GT]) = 0;
-  }
+  auto partials = for_each_range(b, weights,
+      [&](typename T::iterator first, typename T::iterator last, range_sums& sums)
+      {
+        double g1_Hg1 = 0.;  // NOLINT
+        double g1_g1 = 0.;
+        for (typename T::iterator w = first; w != last; ++w)
+        {
+          float* mem1 = mem + (w.index() >> weights.stride_shift()) * b.mem_stride;
+          if (b.m > 0) { mem1[(MEM_XT + origin) % b.mem_stride] = (&(*w))[W_XT]; }
+          mem1[(MEM_GT + origin) % b.mem_stride] = (&(*w))[W_GT];
+          g1_Hg1 += ((double)(&(*w))[W_GT]) * ((&(*w))[W_GT]) * ((&(*w))[W_COND]);
+          g1_g1 += ((double)((&(*w))[W_GT])) * ((&(*w))[W_GT]);
+          (&(*w))[W_DIR] = -(&(*w))[W_COND] * ((&(*w))[W_GT]);
+          ((&(*w))[W_GT]) = 0;
+        }
+        sums[0] = g1_Hg1;
+        sums[1] = g1_g1;
+      });
+  const auto totals = add_ranges(partials);
+  const double g1_Hg1 = totals[0];  // NOLINT
+  const double g1_g1 = totals[1];
+
   lastj = 0;
   if (!all.output_config.quiet)
   {
@@ -292,35 +446,49 @@ void bfgs_iter_middle(
     VW::workspace& all, bfgs& b, float* mem, double* rho, double* alpha, int& lastj, int& origin, T& weights)
 {
   float* mem0 = mem;
+  const auto stride_shift = weights.stride_shift();
+  auto row_mem = [mem0, stride_shift, &b](typename T::iterator& w)
+  { return mem0 + (w.index() >> stride_shift) * b.mem_stride; };
+
   // implement conjugate gradient
   if (b.m == 0)
   {
-    double g_Hy = 0.;  // NOLINT
-    double g_Hg = 0.;  // NOLINT
-    double y = 0.;
-
-    for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-    {
-      mem = mem0 + (w.index() >> weights.stride_shift()) * b.mem_stride;
-      y = (&(*w))[W_GT] - mem[(MEM_GT + origin) % b.mem_stride];
-      g_Hy += ((double)(&(*w))[W_GT]) * ((&(*w))[W_COND]) * y;
-      g_Hg += (static_cast<double>(mem[(MEM_GT + origin) % b.mem_stride])) * ((&(*w))[W_COND]) *
-          mem[(MEM_GT + origin) % b.mem_stride];
-    }
+    auto partials = for_each_range(b, weights,
+        [&](typename T::iterator first, typename T::iterator last, range_sums& sums)
+        {
+          double g_Hy = 0.;  // NOLINT
+          double g_Hg = 0.;  // NOLINT
+          double y = 0.;
+          for (typename T::iterator w = first; w != last; ++w)
+          {
+            float* mem1 = row_mem(w);
+            y = (&(*w))[W_GT] - mem1[(MEM_GT + origin) % b.mem_stride];
+            g_Hy += ((double)(&(*w))[W_GT]) * ((&(*w))[W_COND]) * y;
+            g_Hg += (static_cast<double>(mem1[(MEM_GT + origin) % b.mem_stride])) * ((&(*w))[W_COND]) *
+                mem1[(MEM_GT + origin) % b.mem_stride];
+          }
+          sums[0] = g_Hy;
+          sums[1] = g_Hg;
+        });
+    const auto totals = add_ranges(partials);
 
-    float beta = static_cast<float>(g_Hy / g_Hg);
+    float beta = static_cast<float>(totals[0] / totals[1]);
 
     if (beta < 0.f || std::isnan(beta)) { beta = 0.f; }
 
-    for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-    {
-      mem = mem0 + (w.index() >> weights.stride_shift()) * b.mem_stride;
-      mem[(MEM_GT + origin) % b.mem_stride] = (&(*w))[W_GT];
+    for_each_range(b, weights,
+        [&](typename T::iterator first, typename T::iterator last, range_sums&)
+        {
+          for (typename T::iterator w = first; w != last; ++w)
+          {
+            float* mem1 = row_mem(w);
+            mem1[(MEM_GT + origin) % b.mem_stride] = (&(*w))[W_GT];
 
-      (&(*w))[W_DIR] *= beta;
-      (&(*w))[W_DIR] -= ((&(*w))[W_COND]) * ((&(*w))[W_GT]);
-      (&(*w))[W_GT] = 0;
-    }
+            (&(*w))[W_DIR] *= beta;
+            (&(*w))[W_DIR] -= ((&(*w))[W_COND]) * ((&(*w))[W_GT]);
+            (&(*w))[W_GT] = 0;
+          }
+        });
     // TODO: spdlog can't print partial log lines. Figure out how to handle this..
     if (!all.output_config.quiet) { fprintf(stderr, "%f\t", beta); }
     return;
@@ -331,21 +499,31 @@ void bfgs_iter_middle(
   }
 
   // implement bfgs
-  double y_s = 0.;
-  double y_Hy = 0.;  // NOLINT
-  double s_q = 0.;
-
-  for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-  {
-    float* mem1 = mem + (w.index() >> weights.stride_shift()) * b.mem_stride;
-    mem1[(MEM_YT + origin) % b.mem_stride] = (&(*w))[W_GT] - mem1[(MEM_GT + origin) % b.mem_stride];
-    mem1[(MEM_ST + origin) % b.mem_stride] = (&(*w))[W_XT] - mem1[(MEM_XT + origin) % b.mem_stride];
-    (&(*w))[W_DIR] = (&(*w))[W_GT];
-    y_s += (static_cast<double>(mem1[(MEM_YT + origin) % b.mem_stride])) * mem1[(MEM_ST + origin) % b.mem_stride];
-    y_Hy += (static_cast<double>(mem1[(MEM_YT + origin) % b.mem_stride])) * mem1[(MEM_YT + origin) % b.mem_stride] *
-        ((&(*w))[W_COND]);
-    s_q += (static_cast<double>(mem1[(MEM_ST + origin) % b.mem_stride])) * ((&(*w))[W_GT]);
-  }
+  auto partials = for_each_range(b, weights,
+      [&](typename T::iterator first, typename T::iterator last, range_sums& sums)
+      {
+        double y_s = 0.;
+        double y_Hy = 0.;  // NOLINT
+        double s_q = 0.;
+        for (typename T::iterator w = first; w != last; ++w)
+        {
+          float* mem1 = row_mem(w);
+          mem1[(MEM_YT + origin) % b.mem_stride] = (&(*w))[W_GT] - mem1[(MEM_GT + origin) % b.mem_stride];
+          mem1[(MEM_ST + origin) % b.mem_stride] = (&(*w))[W_XT] - mem1[(MEM_XT + origin) % b.mem_stride];
+          (&(*w))[W_DIR] = (&(*w))[W_GT];
+          y_s += (static_cast<double>(mem1[(MEM_YT + origin) % b.mem_stride])) * mem1[(MEM_ST + origin) % b.mem_stride];
+          y_Hy += (static_cast<double>(mem1[(MEM_YT + origin) % b.mem_stride])) *
+              mem1[(MEM_YT + origin) % b.mem_stride] * ((&(*w))[W_COND]);
+          s_q += (static_cast<double>(mem1[(MEM_ST + origin) % b.mem_stride])) * ((&(*w))[W_GT]);
+        }
+        sums[0] = y_s;
+        sums[1] = y_Hy;
+        sums[2] = s_q;
+      });
+  auto totals = add_ranges(partials);
+  double y_s = totals[0];
+  double y_Hy = totals[1];  // NOLINT
+  double s_q = totals[2];
 
   if (y_s <= 0. || y_Hy <= 0.) { throw curv_ex; }
   rho[0] = 1 / y_s;
@@ -355,46 +533,71 @@ void bfgs_iter_middle(
   for (int j = 0; j < lastj; j++)
   {
     alpha[j] = rho[j] * s_q;
-    s_q = 0.;
-    for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-    {
-      mem = mem0 + (w.index() >> weights.stride_shift()) * b.mem_stride;
-      (&(*w))[W_DIR] -= static_cast<float>(alpha[j]) * mem[(2 * j + MEM_YT + origin) % b.mem_stride];
-      s_q += (static_cast<double>(mem[(2 * j + 2 + MEM_ST + origin) % b.mem_stride])) * ((&(*w))[W_DIR]);
-    }
+    const float alpha_j = static_cast<float>(alpha[j]);
+    partials = for_each_range(b, weights,
+        [&](typename T::iterator first, typename T::iterator last, range_sums& sums)
+        {
+          double partial_s_q = 0.;
+          for (typename T::iterator w = first; w != last; ++w)
+          {
+            float* mem1 = row_mem(w);
+            (&(*w))[W_DIR] -= alpha_j * mem1[(2 * j + MEM_YT + origin) % b.mem_stride];
+            partial_s_q += (static_cast<double>(mem1[(2 * j + 2 + MEM_ST + origin) % b.mem_stride])) * ((&(*w))[W_DIR]);
+          }
+          sums[0] = partial_s_q;
+        });
+    s_q = add_ranges(partials)[0];
   }
 
   alpha[lastj] = rho[lastj] * s_q;
-  double y_r = 0.;
-
-  for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-  {
-    mem = mem0 + (w.index() >> weights.stride_shift()) * b.mem_stride;
-    (&(*w))[W_DIR] -= static_cast<float>(alpha[lastj]) * mem[(2 * lastj + MEM_YT + origin) % b.mem_stride];
-    (&(*w))[W_DIR] *= gamma * ((&(*w))[W_COND]);
-    y_r += (static_cast<double>(mem[(2 * lastj + MEM_YT + origin) % b.mem_stride])) * ((&(*w))[W_DIR]);
-  }
+  const float alpha_last = static_cast<float>(alpha[lastj]);
+  partials = for_each_range(b, weights,
+      [&](typename T::iterator first, typename T::iterator last, range_sums& sums)
+      {
+        double y_r = 0.;
+        for (typename T::iterator w = first; w != last; ++w)
+        {
+          float* mem1 = row_mem(w);
+          (&(*w))[W_DIR] -= alpha_last * mem1[(2 * lastj + MEM_YT + origin) % b.mem_stride];
+          (&(*w))[W_DIR] *= gamma * ((&(*w))[W_COND]);
+          y_r += (static_cast<double>(mem1[(2 * lastj + MEM_YT + origin) % b.mem_stride])) * ((&(*w))[W_DIR]);
+        }
+        sums[0] = y_r;
+      });
+  double y_r = add_ranges(partials)[0];
 
   double coef_j;
 
   for (int j = lastj; j > 0; j--)
   {
     coef_j = alpha[j] - rho[j] * y_r;
-    y_r = 0.;
-    for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-    {
-      mem = mem0 + (w.index() >> weights.stride_shift()) * b.mem_stride;
-      (&(*w))[W_DIR] += static_cast<float>(coef_j) * mem[(2 * j + MEM_ST + origin) % b.mem_stride];
-      y_r += (static_cast<double>(mem[(2 * j - 2 + MEM_YT + origin) % b.mem_stride])) * ((&(*w))[W_DIR]);
-    }
+    const float coef = static_cast<float>(coef_j);
+    partials = for_each_range(b, weights,
+        [&](typename T::iterator first, typename T::iterator last, range_sums& sums)
+        {
+          double partial_y_r = 0.;
+          for (typename T::iterator w = first; w != last; ++w)
+          {
+            float* mem1 = row_mem(w);
+            (&(*w))[W_DIR] += coef * mem1[(2 * j + MEM_ST + origin) % b.mem_stride];
+            partial_y_r += (static_cast<double>(mem1[(2 * j - 2 + MEM_YT + origin) % b.mem_stride])) * ((&(*w))[W_DIR]);
+          }
+          sums[0] = partial_y_r;
+        });
+    y_r = add_ranges(partials)[0];
   }
 
   coef_j = alpha[0] - rho[0] * y_r;
-  for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-  {
-    mem = mem0 + (w.index() >> weights.stride_shift()) * b.mem_stride;
-    (&(*w))[W_DIR] = -(&(*w))[W_DIR] - static_cast<float>(coef_j) * mem[(MEM_ST + origin) % b.mem_stride];
-  }
+  const float coef_0 = static_cast<float>(coef_j);
+  for_each_range(b, weights,
+      [&](typename T::iterator first, typename T::iterator last, range_sums&)
+      {
+        for (typename T::iterator w = first; w != last; ++w)
+        {
+          float* mem1 = row_mem(w);
+          (&(*w))[W_DIR] = -(&(*w))[W_DIR] - coef_0 * mem1[(MEM_ST + origin) % b.mem_stride];
+        }
+      });
 
   /*********************
   ** shift
@@ -403,13 +606,17 @@ void bfgs_iter_middle(
   lastj = (lastj < b.m - 1) ? lastj + 1 : b.m - 1;
   origin = (origin + b.mem_stride - 2) % b.mem_stride;
 
-  for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-  {
-    mem = mem0 + (w.index() >> weights.stride_shift()) * b.mem_stride;
-    mem[(MEM_GT + origin) % b.mem_stride] = (&(*w))[W_GT];
-    mem[(MEM_XT + origin) % b.mem_stride] = (&(*w))[W_XT];
-    (&(*w))[W_GT] = 0;
-  }
+  for_each_range(b, weights,
+      [&](typename T::iterator first, typename T::iterator last, range_sums&)
+      {
+        for (typename T::iterator w = first; w != last; ++w)
+        {
+          float* mem1 = row_mem(w);
+          mem1[(MEM_GT + origin) % b.mem_stride] = (&(*w))[W_GT];
+          mem1[(MEM_XT + origin) % b.mem_stride] = (&(*w))[W_XT];
+          (&(*w))[W_GT] = 0;
+        }
+      });
   for (int j = lastj; j > 0; j--) { rho[j] = rho[j - 1]; }
 }
 
@@ -423,19 +630,31 @@ template <class T>
 double wolfe_eval(VW::workspace& all, bfgs& b, float* mem, double loss_sum, double previous_loss_sum, double step_size,
     double importance_weight_sum, int& origin, double& wolfe1, T& weights)
 {
-  double g0_d = 0.;
-  double g1_d = 0.;
-  double g1_Hg1 = 0.;  // NOLINT
-  double g1_g1 = 0.;
-
-  for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-  {
-    float* mem1 = mem + (w.index() >> weights.stride_shift()) * b.mem_stride;
-    g0_d += (static_cast<double>(mem1[(MEM_GT + origin) % b.mem_stride])) * ((&(*w))[W_DIR]);
-    g1_d += ((double)(&(*w))[W_GT]) * (&(*w))[W_DIR];
-    g1_Hg1 += ((double)(&(*w))[W_GT]) * (&(*w))[W_GT] * ((&(*w))[W_COND]);
-    g1_g1 += ((double)(&(*w))[W_GT]) * (&(*w))[W_GT];
-  }
+  auto partials = for_each_range(b, weights,
+      [&](typename T::iterator first, typename T::iterator last, range_sums& sums)
+      {
+        double g0_d = 0.;
+        double g1_d = 0.;
+        double g1_Hg1 = 0.;  // NOLINT
+        double g1_g1 = 0.;
+        for (typename T::iterator w = first; w != last; ++w)
+        {
+          float* mem1 = mem + (w.index() >> weights.stride_shift()) * b.mem_stride;
+          g0_d += (static_cast<double>(mem1[(MEM_GT + origin) % b.mem_stride])) * ((&(*w))[W_DIR]);
+          g1_d += ((double)(&(*w))[W_GT]) * (&(*w))[W_DIR];
+          g1_Hg1 += ((double)(&(*w))[W_GT]) * (&(*w))[W_GT] * ((&(*w))[W_COND]);
+          g1_g1 += ((double)(&(*w))[W_GT]) * (&(*w))[W_GT];
+        }
+        sums[0] = g0_d;
+        sums[1] = g1_d;
+        sums[2] = g1_Hg1;
+        sums[3] = g1_g1;
+      });
+  const auto totals = add_ranges(partials);
+  const double g0_d = totals[0];
+  const double g1_d = totals[1];
+  const double g1_Hg1 = totals[2];  // NOLINT
+  const double g1_g1 = totals[3];
 
   wolfe1 = (loss_sum - previous_loss_sum) / (step_size * g0_d);
   double wolfe2 = g1_d / g0_d;
@@ -468,26 +687,31 @@ template <class T>
 double add_regularization(VW::workspace& all, bfgs& b, float regularization, T& weights)
 {
   // compute the derivative difference
-  double ret = 0.;
-
-  if (b.regularizers == nullptr)
-  {
-    for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-    {
-      (&(*w))[W_GT] += regularization * (*w);
-      ret += 0.5 * regularization * (*w) * (*w);
-    }
-  }
-  else
-  {
-    for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-    {
-      uint64_t i = w.index() >> weights.stride_shift();
-      VW::weight delta_weight = *w - b.regularizers[2 * i + 1];
-      (&(*w))[W_GT] += b.regularizers[2 * i] * delta_weight;
-      ret += 0.5 * b.regularizers[2 * i] * delta_weight * delta_weight;
-    }
-  }
+  auto partials = for_each_range(b, weights,
+      [&](typename T::iterator first, typename T::iterator last, range_sums& sums)
+      {
+        double ret = 0.;
+        if (b.regularizers == nullptr)
+        {
+          for (typename T::iterator w = first; w != last; ++w)
+          {
+            (&(*w))[W_GT] += regularization * (*w);
+            ret += 0.5 * regularization * (*w) * (*w);
+          }
+        }
+        else
+        {
+          for (typename T::iterator w = first; w != last; ++w)
+          {
+            uint64_t i = w.index() >> weights.stride_shift();
+            VW::weight delta_weight = *w - b.regularizers[2 * i + 1];
+            (&(*w))[W_GT] += b.regularizers[2 * i] * delta_weight;
+            ret += 0.5 * b.regularizers[2 * i] * delta_weight * delta_weight;
+          }
+        }
+        sums[0] = ret;
+      });
+  double ret = add_ranges(partials)[0];
 
   // if we're not regularizing the intercept term, then subtract it off from the result above
   // when accessing weights[constant], always use weights.strided_index(constant)
@@ -521,33 +745,44 @@ double add_regularization(VW::workspace& all, bfgs& b, float regularization)
 template <class T>
 void finalize_preconditioner(VW::workspace& /* all */, bfgs& b, float regularization, T& weights)
 {
-  float max_hessian = 0.f;
+  auto partials = for_each_range(b, weights,
+      [&](typename T::iterator first, typename T::iterator last, range_sums& sums)
+      {
+        float max_hessian = 0.f;
+        if (b.regularizers == nullptr)
+        {
+          for (typename T::iterator w = first; w != last; ++w)
+          {
+            (&(*w))[W_COND] += regularization;
+            if ((&(*w))[W_COND] > max_hessian) { max_hessian = (&(*w))[W_COND]; }
+            if ((&(*w))[W_COND] > 0) { (&(*w))[W_COND] = 1.f / (&(*w))[W_COND]; }
+          }
+        }
+        else
+        {
+          for (typename T::iterator w = first; w != last; ++w)
+          {
+            (&(*w))[W_COND] += b.regularizers[2 * (w.index() >> weights.stride_shift())];
+            if ((&(*w))[W_COND] > max_hessian) { max_hessian = (&(*w))[W_COND]; }
+            if ((&(*w))[W_COND] > 0) { (&(*w))[W_COND] = 1.f / (&(*w))[W_COND]; }
+          }
+        }
+        sums[0] = max_hessian;
+      });
 
-  if (b.regularizers == nullptr)
-  {
-    for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-    {
-      (&(*w))[W_COND] += regularization;
-      if ((&(*w))[W_COND] > max_hessian) { max_hessian = (&(*w))[W_COND]; }
-      if ((&(*w))[W_COND] > 0) { (&(*w))[W_COND] = 1.f / (&(*w))[W_COND]; }
-    }
-  }
-  else
-  {
-    for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-    {
-      (&(*w))[W_COND] += b.regularizers[2 * (w.index() >> weights.stride_shift())];
-      if ((&(*w))[W_COND] > max_hessian) { max_hessian = (&(*w))[W_COND]; }
-      if ((&(*w))[W_COND] > 0) { (&(*w))[W_COND] = 1.f / (&(*w))[W_COND]; }
-    }
-  }
+  float max_hessian = 0.f;
+  for (const auto& partial : partials) { max_hessian = std::max(max_hessian, static_cast<float>(partial[0])); }
 
   float max_precond = (max_hessian == 0.f) ? 0.f : MAX_PRECOND_RATIO / max_hessian;
 
-  for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-  {
-    if (std::isinf((&(*w))[W_COND]) || (&(*w))[W_COND] > max_precond) { (&(*w))[W_COND] = max_precond; }
-  }
+  for_each_range(b, weights,
+      [&](typename T::iterator first, typename T::iterator last, range_sums&)
+      {
+        for (typename T::iterator w = first; w != last; ++w)
+        {
+          if (std::isinf((&(*w))[W_COND]) || (&(*w))[W_COND] > max_precond) { (&(*w))[W_COND] = max_precond; }
+        }
+      });
 }
 void finalize_preconditioner(VW::workspace& all, bfgs& b, float regularization)
 {
@@ -622,13 +857,18 @@ void zero_state(VW::workspace& all)
 template <class T>
 double derivative_in_direction(VW::workspace& /* all */, bfgs& b, float* mem, int& origin, T& weights)
 {
-  double ret = 0.;
-  for (typename T::iterator w = weights.begin(); w != weights.end(); ++w)
-  {
-    float* mem1 = mem + (w.index() >> weights.stride_shift()) * b.mem_stride;
-    ret += (static_cast<double>(mem1[(MEM_GT + origin) % b.mem_stride])) * (&(*w))[W_DIR];
-  }
-  return ret;
+  auto partials = for_each_range(b, weights,
+      [&](typename T::iterator first, typename T::iterator last, range_sums& sums)
+      {
+        double ret = 0.;
+        for (typename T::iterator w = first; w != last; ++w)
+        {
+          float* mem1 = mem + (w.index() >> weights.stride_shift()) * b.mem_stride;
+          ret += (static_cast<double>(mem1[(MEM_GT + origin) % b.mem_stride])) * (&(*w))[W_DIR];
+        }
+        sums[0] = ret;
+      });
+  return add_ranges(partials)[0];
 }
 
 double derivative_in_direction(VW::workspace& all, bfgs& b, float* mem, int& origin)
@@ -638,18 +878,22 @@ double derivative_in_direction(VW::workspace& all, bfgs& b, float* mem, int& ori
 }
 
 template <class T>
-void update_weight(VW::workspace& /* all */, float step_size, T& w)
+void update_weight(VW::workspace& /* all */, bfgs& b, float step_size, T& w)
 {
-  for (typename T::iterator iter = w.begin(); iter != w.end(); ++iter)
-  {
-    (&(*iter))[W_XT] += step_size * (&(*iter))[W_DIR];
-  }
+  for_each_range(b, w,
+      [step_size](typename T::iterator first, typename T::iterator last, range_sums&)
+      {
+        for (typename T::iterator iter = first; iter != last; ++iter)
+        {
+          (&(*iter))[W_XT] += step_size * (&(*iter))[W_DIR];
+        }
+      });
 }
 
-void update_weight(VW::workspace& all, float step_size)
+void update_weight(VW::workspace& all, bfgs& b, float step_size)
 {
-  if (all.weights.sparse) { update_weight(all, step_size, all.weights.sparse_weights); }
-  else { update_weight(all, step_size, all.weights.dense_weights); }
+  if (all.weights.sparse) { update_weight(all, b, step_size, all.weights.sparse_weights); }
+  else { update_weight(all, b, step_size, all.weights.dense_weights); }
 }
 
 int process_pass(VW::workspace& all, bfgs& b)
@@ -694,13 +938,13 @@ int process_pass(VW::workspace& all, bfgs& b)
     else
     {
       b.step_size = 0.5;
-      float d_mag = direction_magnitude(all);
+      float d_mag = direction_magnitude(all, b);
       b.t_end_global = std::chrono::system_clock::now();
       b.net_time = static_cast<double>(
           std::chrono::duration_cast<std::chrono::milliseconds>(b.t_end_global - b.t_start_global).count());
       if (!all.output_config.quiet) { fprintf(stderr, "%-10s\t%-10.5f\t%-.5f\n", "", d_mag, b.step_size); }
       b.predictions.clear();
-      update_weight(all, b.step_size);
+      update_weight(all, b, b.step_size);
     }
   }
   else
@@ -766,7 +1010,7 @@ int process_pass(VW::workspace& all, bfgs& b)
           fprintf(stderr, "%-10s\t%-10s\t(revise x %.1f)\t%-.5f\n", "", "", ratio, new_step);
         }
         b.predictions.clear();
-        update_weight(all, static_cast<float>(-b.step_size + new_step));
+        update_weight(all, b, static_cast<float>(-b.step_size + new_step));
         b.step_size = static_cast<float>(new_step);
         zero_derivative(all);
         b.loss_sum = 0.;
@@ -810,13 +1054,13 @@ int process_pass(VW::workspace& all, bfgs& b)
         }
         else
         {
-          float d_mag = direction_magnitude(all);
+          float d_mag = direction_magnitude(all, b);
           b.t_end_global = std::chrono::system_clock::now();
           b.net_time = static_cast<double>(
               std::chrono::duration_cast<std::chrono::milliseconds>(b.t_end_global - b.t_start_global).count());
           if (!all.output_config.quiet) { fprintf(stderr, "%-10s\t%-10.5f\t%-.5f\n", "", d_mag, b.step_size); }
           b.predictions.clear();
-          update_weight(all, b.step_size);
+          update_weight(all, b, b.step_size);
         }
       }
     }
@@ -850,10 +1094,10 @@ int process_pass(VW::workspace& all, bfgs& b)
       }
       else { b.step_size = -dd / static_cast<float>(b.curvature); }
 
-      float d_mag = direction_magnitude(all);
+      float d_mag = direction_magnitude(all, b);
 
       b.predictions.clear();
-      update_weight(all, b.step_size);
+      update_weight(all, b, b.step_size);
       b.t_end_global = std::chrono::system_clock::now();
       b.net_time = static_cast<double>(
           std::chrono::duration_cast<std::chrono::milliseconds>(b.t_end_global - b.t_start_global).count());
@@ -895,9 +1139,11 @@ void process_example(VW::workspace& all, bfgs& b, VW::example& ec)
   /********************************************************************/
   /* I) GRADIENT CALCULATION ******************************************/
   /********************************************************************/
+  const bool stage_updates = b.thread_pool != nullptr && !all.weights.sparse;
   if (b.gradient_pass)
   {
-    ec.pred.scalar = predict_and_gradient(all, ec);  // w[0] & w[1]
+    // w[0] & w[1], and w[3] as well when staging
+    ec.pred.scalar = stage_updates ? predict_and_stage_gradient(all, b, ec) : predict_and_gradient(all, ec);
     ec.loss = all.loss_config.loss->get_loss(all.sd.get(), ec.pred.scalar, ld.label) * ec.weight;
     b.loss_sum += ec.loss;
     b.predictions.push_back(ec.pred.scalar);
@@ -920,7 +1166,7 @@ void process_example(VW::workspace& all, bfgs& b, VW::example& ec)
   }
   ec.updated_prediction = ec.pred.scalar;
 
-  if (b.preconditioner_pass)
+  if (b.preconditioner_pass && !(stage_updates && b.gradient_pass))
   {
     update_preconditioner(all, ec);  // w[3]
   }
@@ -930,6 +1176,8 @@ void end_pass(bfgs& b)
 {
   VW::workspace* all = b.all;
 
+  // Gradients staged during the pass belong in the weights even when no further pass follows.
+  apply_staged_updates(*all, b);
   if (b.current_pass <= b.final_pass)
   {
     if (b.current_pass < b.final_pass)
@@ -1137,6 +1385,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::bfgs_setup(VW::setup_base_
 
   bool bfgs_option = false;
   int local_m = 0;
+  uint64_t num_threads = 1;
   float local_rel_threshold = 0.f;
   bool local_hessian_on = false;
   option_group_definition bfgs_options("[Reduction] LBFGS and Conjugate Gradient");
@@ -1145,6 +1394,11 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::bfgs_setup(VW::setup_base_
   bfgs_options.add(make_option("hessian_on", local_hessian_on).help("Use second derivative in line search"));
   bfgs_options.add(make_option("mem", local_m).default_value(15).help("Memory in bfgs"));
   bfgs_options.add(make_option("termination", local_rel_threshold).default_value(0.001f).help("Termination threshold"));
+  bfgs_options.add(make_option("bfgs_threads", num_threads)
+                       .default_value(1)
+                       .experimental()
+                       .help("Number of threads used for passes over dense weights and for applying gradients. Results "
+                             "are deterministic for a given number of threads"));
 
   auto conjugate_gradient_enabled = options.add_parse_and_check_necessary(conjugate_gradient_options);
   auto bfgs_enabled = options.add_parse_and_check_necessary(bfgs_options);
@@ -1161,6 +1415,20 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::bfgs_setup(VW::setup_base_
   b->final_pass = all.runtime_config.numpasses;
   b->no_win_counter = 0;
 
+  if (num_threads == 0) { THROW("--bfgs_threads must be at least 1"); }
+  if (num_threads > 1)
+  {
+    if (all.weights.sparse)
+    {
+      all.logger.err_warn("--bfgs_threads is ignored with --sparse_weights, BFGS runs on a single thread.");
+    }
+    else
+    {
+      b->num_threads = num_threads;
+      b->thread_pool = VW::make_unique<VW::thread_pool>(num_threads);
+    }
+  }
+
   if (bfgs_enabled)
   {
     b->m = local_m;
@@ -8,6 +8,8 @@
 #include "vw/core/global_data.h"
 #include "vw/core/learner.h"
 #include "vw/core/loss_functions.h"
+#include "vw/core/multi_model_utils.h"
+#include "vw/core/scope_exit.h"
 #include "vw/core/setup_base.h"
 #include "vw/core/shared_data.h"
 #include "vw/core/vw.h"
@@ -40,6 +42,7 @@ public:
   std::vector<double> pred_vec;
   VW::workspace* all = nullptr;  // for raw prediction and loss
   std::shared_ptr<VW::rand_state> random_state;
+  VW::multi_model::fused_pass_state fused_passes;
 };
 
 void bs_predict_mean(const VW::workspace& all, VW::example& ec, const std::vector<double>& pred_vec)
@@ -179,6 +182,10 @@ void predict_or_learn(bs_data& d, learner& base, VW::example& ec)
   std::stringstream output_string_stream;
   d.pred_vec.clear();
 
+  // Rounds only differ in their weights, so the base predicts all of them from one traversal of the features.
+  VW::reductions::multi_model::begin_fused_pass(ec, base, d.num_bootstrap_rounds, d.fused_passes);
+  auto fused_pass_guard = VW::scope_exit([&ec] { VW::reductions::multi_model::end_fused_pass(ec); });
+
   for (size_t i = 1; i <= d.num_bootstrap_rounds; i++)
   {
     ec.weight = weight_temp * static_cast<float>(bs::weight_gen(*d.random_state));
@@ -256,8 +263,10 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::bs_setup(VW::setup_base_i&
   data->all = &all;
   data->random_state = all.get_random_state();
 
-  auto l = make_reduction_learner(std::move(data), require_singleline(stack_builder.setup_base_learner(feature_width)),
-      predict_or_learn<true>, predict_or_learn<false>, stack_builder.get_setupfn_name(bs_setup))
+  auto base = require_singleline(stack_builder.setup_base_learner(feature_width));
+  data->fused_passes.can_fuse = VW::reductions::multi_model::can_fuse_models(*base);
+
+  auto l = make_reduction_learner(std::move(data), base, predict_or_learn<true>, predict_or_learn<false>, stack_builder.get_setupfn_name(bs_setup))
                .set_feature_width(feature_width)
                .set_learn_returns_prediction(true)
                .set_output_example_prediction(output_example_prediction_bs)
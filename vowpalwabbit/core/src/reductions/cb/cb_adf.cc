@@ -246,7 +246,8 @@ void VW::reductions::cb_adf::learn(learner& base, VW::multi_ex& ec_seq)
   if (VW::test_cb_adf_sequence(ec_seq) != nullptr)
   {
     _offset = ec_seq[0]->ft_offset;
-    _offset_index = _offset / _all->weights.stride();
+    // Models above are feature_width_below weights apart, more than one when a reduction below such as lrq widens them.
+    _offset_index = _offset / base.feature_width_below;
     _gen_cs_dr.known_cost = VW::get_observed_cost_or_default_cb_adf(ec_seq);  // need to set for test case
     switch (_cb_type)
     {
@@ -274,7 +275,7 @@ void VW::reductions::cb_adf::learn(learner& base, VW::multi_ex& ec_seq)
 void VW::reductions::cb_adf::predict(learner& base, VW::multi_ex& ec_seq)
 {
   _offset = ec_seq[0]->ft_offset;
-  _offset_index = _offset / _all->weights.stride();
+  _offset_index = _offset / base.feature_width_below;
   _gen_cs_dr.known_cost = VW::get_observed_cost_or_default_cb_adf(ec_seq);  // need to set for test case
   details::gen_cs_test_example(ec_seq, _cs_labels);                         // create test labels.
   details::cs_ldf_learn_or_predict<false>(base, ec_seq, _cb_labels, _cs_labels, _prepped_cs_labels, false, _offset);
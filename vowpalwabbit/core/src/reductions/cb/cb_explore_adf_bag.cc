@@ -8,12 +8,14 @@
 #include "vw/core/gen_cs_example.h"
 #include "vw/core/global_data.h"
 #include "vw/core/label_parser.h"
+#include "vw/core/multi_model_utils.h"
 #include "vw/core/numeric_casts.h"
 #include "vw/core/parser.h"
 #include "vw/core/reductions/bs.h"
 #include "vw/core/reductions/cb/cb_adf.h"
 #include "vw/core/reductions/cb/cb_explore.h"
 #include "vw/core/reductions/cb/cb_explore_adf_common.h"
+#include "vw/core/scope_exit.h"
 #include "vw/core/setup_base.h"
 #include "vw/explore/explore.h"
 
@@ -34,8 +36,8 @@ class cb_explore_adf_bag
 public:
   using PredictionT = VW::v_array<VW::action_score>;
 
-  cb_explore_adf_bag(
-      float epsilon, size_t bag_size, bool greedify, bool first_only, std::shared_ptr<VW::rand_state> random_state);
+  cb_explore_adf_bag(float epsilon, size_t bag_size, bool greedify, bool first_only,
+      std::shared_ptr<VW::rand_state> random_state, bool can_fuse_models);
 
   // Should be called through cb_explore_adf_base for pre/post-processing
   void predict(VW::LEARNER::learner& base, VW::multi_ex& examples);
@@ -50,6 +52,7 @@ private:
   bool _greedify;
   bool _first_only;
   std::shared_ptr<VW::rand_state> _random_state;
+  VW::multi_model::fused_pass_state _fused_passes;
 
   VW::v_array<VW::action_score> _action_probs;
   std::vector<float> _scores;
@@ -57,14 +60,15 @@ private:
   uint32_t get_bag_learner_update_count(uint32_t learner_index);
 };
 
-cb_explore_adf_bag::cb_explore_adf_bag(
-    float epsilon, size_t bag_size, bool greedify, bool first_only, std::shared_ptr<VW::rand_state> random_state)
+cb_explore_adf_bag::cb_explore_adf_bag(float epsilon, size_t bag_size, bool greedify, bool first_only,
+    std::shared_ptr<VW::rand_state> random_state, bool can_fuse_models)
     : _epsilon(epsilon)
     , _bag_size(bag_size)
     , _greedify(greedify)
     , _first_only(first_only)
     , _random_state(std::move(random_state))
 {
+  _fused_passes.can_fuse = can_fuse_models;
 }
 
 uint32_t cb_explore_adf_bag::get_bag_learner_update_count(uint32_t learner_index)
@@ -89,6 +93,8 @@ void cb_explore_adf_bag::predict(VW::LEARNER::learner& base, VW::multi_ex& examp
   _scores.assign(num_actions, 0.f);
   _top_actions.assign(num_actions, 0);
 
+  VW::reductions::multi_model::begin_fused_pass(examples, base, _bag_size, _fused_passes);
+  auto fused_pass_guard = VW::scope_exit([&examples] { VW::reductions::multi_model::end_fused_pass(examples); });
   for (uint32_t i = 0; i < _bag_size; i++)
   {
     VW::LEARNER::multiline_learn_or_predict<false>(base, examples, examples[0]->ft_offset, i);
@@ -118,6 +124,8 @@ void cb_explore_adf_bag::predict(VW::LEARNER::learner& base, VW::multi_ex& examp
 
 void cb_explore_adf_bag::learn(VW::LEARNER::learner& base, VW::multi_ex& examples)
 {
+  VW::reductions::multi_model::begin_fused_pass(examples, base, _bag_size, _fused_passes);
+  auto fused_pass_guard = VW::scope_exit([&examples] { VW::reductions::multi_model::end_fused_pass(examples); });
   for (uint32_t i = 0; i < _bag_size; i++)
   {
     // learn_count determines how many times learner (i) will learn from this
@@ -199,7 +207,8 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::cb_explore_adf_bag_setup(V
 
   using explore_type = cb_explore_adf_base<cb_explore_adf_bag>;
   auto data = VW::make_unique<explore_type>(all.output_runtime.global_metrics.are_metrics_enabled(), epsilon,
-      VW::cast_to_smaller_type<size_t>(bag_size), greedify, first_only, all.get_random_state());
+      VW::cast_to_smaller_type<size_t>(bag_size), greedify, first_only, all.get_random_state(),
+      VW::reductions::multi_model::can_fuse_models(*base));
   auto l = make_reduction_learner(std::move(data), base, explore_type::learn, explore_type::predict,
       stack_builder.get_setupfn_name(cb_explore_adf_bag_setup))
                .set_input_label_type(VW::label_type_t::CB)
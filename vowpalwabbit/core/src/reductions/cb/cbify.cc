@@ -79,20 +79,11 @@ void cbify_adf_data::copy_example_to_adf(parameters& weights, VW::example& ec)
     auto& lab = eca.l.cb;
     lab.reset_to_default();
 
-    // copy data
-    VW::copy_example_data(&eca, &ec);
-
-    // offset indices for given action
-    for (features& fs : eca)
-    {
-      for (feature_index& idx : fs.indices)
-      {
-        auto rawidx = idx;
-        rawidx -= rawidx & custom_index_mask;
-        rawidx += a * feature_width_below;
-        idx = rawidx & mask;
-      }
-    }
+    // copy data, offsetting indices for given action
+    const uint64_t action_offset = a * feature_width_below;
+    VW::copy_example_data_with_index_map(&eca, &ec,
+        [this, mask, action_offset](feature_index idx)
+        { return ((idx - (idx & custom_index_mask)) + action_offset) & mask; });
 
     // avoid empty example by adding a tag (hacky)
     if (VW::example_is_newline_not_header_cb(eca) && eca.l.cb.is_test_label()) { eca.tag.push_back('n'); }
@@ -67,17 +67,17 @@ void one_pass_svd_impl::generate_AOmega(const multi_ex& examples, const std::vec
 
   // example hash has been generated before shared feature merger, so each one should be a represenative of what the
   // hash is without the shared features which will be removed anyway before calculating AOmega
+  // cached rows do not depend on the weights or on the other actions in the request, so only the actions that have not
+  // been seen before need their row computed
+  _cached_rows.resize(examples.size());
   for (size_t i = 0; i < examples.size(); ++i)
   {
     if (shared_example != nullptr)
     {
       VW::details::truncate_example_namespaces_from_example(*examples[i], *shared_example);
     }
-    if (cached_example_hashes.find(examples[i]->get_or_calculate_order_independent_feature_space_hash()) ==
-        cached_example_hashes.end())
-    {
-      cached_example_hashes.clear();
-    }
+    auto it = cached_example_hashes.find(examples[i]->get_or_calculate_order_independent_feature_space_hash());
+    _cached_rows[i] = it == cached_example_hashes.end() ? nullptr : &it->second;
   }
 
   const float scaling_factor = 1.f / std::sqrt(p);
@@ -99,28 +99,22 @@ void one_pass_svd_impl::generate_AOmega(const multi_ex& examples, const std::vec
   }
 #endif
 
-  auto calculate_aomega_row =
-      [compute_dot_prod](uint64_t row_index_begin, uint64_t row_index_end, uint64_t p, VW::workspace* _all,
-          uint64_t _seed, const multi_ex& examples, Eigen::MatrixXf& AOmega, const std::vector<float>& shrink_factors,
-          float scaling_factor, std::unordered_map<uint64_t, Eigen::VectorXf>& cached_example_hashes) -> void
+  // rows are computed without the shrink factors so that they can be cached, shrink factors are applied afterwards
+  auto calculate_aomega_row = [compute_dot_prod](uint64_t row_index_begin, uint64_t row_index_end, uint64_t p,
+                                  VW::workspace* _all, uint64_t _seed, const multi_ex& examples, Eigen::MatrixXf& AOmega,
+                                  float scaling_factor, const std::vector<const Eigen::VectorXf*>& cached_rows) -> void
   {
     for (auto row_index = row_index_begin; row_index < row_index_end; ++row_index)
     {
-      VW::example* ex = examples[row_index];
-      if (cached_example_hashes.find(ex->get_or_calculate_order_independent_feature_space_hash()) ==
-          cached_example_hashes.end())
+      if (cached_rows[row_index] == nullptr)
       {
+        VW::example* ex = examples[row_index];
         for (uint64_t col = 0; col < p; ++col)
         {
-          float final_dot_prod = compute_dot_prod(col, _all, _seed, ex);
-          AOmega(row_index, col) = final_dot_prod * shrink_factors[row_index] * scaling_factor;
+          AOmega(row_index, col) = compute_dot_prod(col, _all, _seed, ex) * scaling_factor;
         }
       }
-      else
-      {
-        AOmega.row(row_index) = cached_example_hashes[ex->get_or_calculate_order_independent_feature_space_hash()] *
-            shrink_factors[row_index];
-      }
+      else { AOmega.row(row_index) = *cached_rows[row_index]; }
     }
   };
 
@@ -138,7 +132,7 @@ void one_pass_svd_impl::generate_AOmega(const multi_ex& examples, const std::vec
 
     _futures.emplace_back(
         _thread_pool.submit(calculate_aomega_row, row_index_begin, row_index_end, p, _all, _seed, std::cref(examples),
-            std::ref(AOmega), std::cref(shrink_factors), scaling_factor, std::ref(cached_example_hashes)));
+            std::ref(AOmega), scaling_factor, std::cref(_cached_rows)));
 
     row_index_begin = row_index_end;
   }
@@ -149,11 +143,11 @@ void one_pass_svd_impl::generate_AOmega(const multi_ex& examples, const std::vec
   for (size_t i = 0; i < examples.size(); i++)
   {
     auto ex = examples[i];
-    if (cached_example_hashes.find(ex->feature_space_hash) == cached_example_hashes.end() &&
-        ex->is_set_feature_space_hash)
+    if (_cached_rows[i] == nullptr && ex->is_set_feature_space_hash)
     {
-      cached_example_hashes.emplace(ex->feature_space_hash, AOmega.row(i) / shrink_factors[i]);
+      cached_example_hashes.emplace(ex->feature_space_hash, AOmega.row(i));
     }
+    AOmega.row(i) *= shrink_factors[i];
     if (shared_example != nullptr) { VW::details::append_example_namespaces_from_example(*ex, *shared_example); }
   }
 }
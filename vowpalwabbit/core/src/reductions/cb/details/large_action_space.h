@@ -94,6 +94,8 @@ private:
   simd_type _use_simd = simd_type::NO_SIMD;
 #endif
   std::vector<std::future<void>> _futures;
+  // per row of the current request, the cached projection row of that action or nullptr if it needs computing
+  std::vector<const Eigen::VectorXf*> _cached_rows;
   Eigen::JacobiSVD<Eigen::MatrixXf> _svd;
 };
 
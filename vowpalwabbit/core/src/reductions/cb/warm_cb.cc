@@ -162,17 +162,11 @@ void copy_example_to_adf(warm_cb& data, VW::example& ec)
     auto& lab = eca.l.cb;
     lab.reset_to_default();
 
-    // copy data
-    VW::copy_example_data(&eca, &ec);
-
-    // offset indices for given action
-    for (VW::features& fs : eca)
-    {
-      for (VW::feature_index& idx : fs.indices)
-      {
-        idx = ((((idx >> ss) * 28904713) + 4832917 * static_cast<uint64_t>(a)) << ss) & mask;
-      }
-    }
+    // copy data, hashing indices for given action
+    const uint64_t action_hash = 4832917 * static_cast<uint64_t>(a);
+    VW::copy_example_data_with_index_map(&eca, &ec,
+        [ss, mask, action_hash](VW::feature_index idx)
+        { return ((((idx >> ss) * 28904713) + action_hash) << ss) & mask; });
 
     // avoid empty example by adding a tag (hacky)
     if (VW::example_is_newline_not_header_cb(eca) && eca.l.cb.is_test_label()) { eca.tag.push_back('n'); }
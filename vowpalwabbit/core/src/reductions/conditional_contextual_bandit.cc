@@ -30,6 +30,8 @@
 
 #include <algorithm>
 #include <bitset>
+#include <cstring>
+#include <iterator>
 #include <numeric>
 #include <unordered_set>
 
@@ -82,6 +84,9 @@ public:
   size_t base_learner_stride_shift = 0;
   bool all_slots_loss_report = false;
   bool no_pred = false;
+  // Decided at setup, see can_reuse_slot_invariant_predictions.
+  bool reuse_slot_invariant_predictions = false;
+  uint64_t decision_count = 0;
 
   VW::vector_pool<VW::cb_class> cb_label_pool;
   VW::v_array_pool<VW::action_score> action_score_pool;
@@ -295,6 +300,62 @@ void remove_slot_features(VW::example* shared, VW::example* slot)
   }
 }
 
+// When predicting, the weights do not change between the slots of a decision and only the features of the slot
+// namespaces (and the slot id) differ from one slot to the next. Marking the actions with them lets gd compute the rest
+// of each action's prediction once per decision instead of once per slot.
+void mark_slot_invariant_actions(ccb_data& data, bool with_slot_id)
+{
+  std::bitset<VW::NUM_NAMESPACES> slot_namespaces;
+  for (const auto* slot : data.slots)
+  {
+    for (auto index : slot->indices)
+    {
+      if (index == VW::details::CONSTANT_NAMESPACE) { continue; }
+      slot_namespaces[index == VW::details::DEFAULT_NAMESPACE ? VW::details::CCB_SLOT_NAMESPACE : index] = true;
+    }
+  }
+  if (with_slot_id) { slot_namespaces[VW::details::CCB_ID_NAMESPACE] = true; }
+
+  const uint64_t decision_id = ++data.decision_count;
+  for (auto* action : data.actions)
+  {
+    auto& red_features = action->ex_reduction_features.template get<VW::ccb_reduction_features>();
+    red_features.decision_id = decision_id;
+    red_features.slot_namespaces = slot_namespaces;
+  }
+}
+
+void unmark_slot_invariant_actions(ccb_data& data)
+{
+  for (auto* action : data.actions)
+  {
+    auto& red_features = action->ex_reduction_features.template get<VW::ccb_reduction_features>();
+    red_features.decision_id = 0;
+    red_features.slot_namespaces.reset();
+  }
+}
+
+// Reusing the slot invariant part of a prediction is only correct if the features of the other namespaces reach gd
+// unchanged for every slot. Reductions which generate features from the slot namespaces, like lrq, break that, so the
+// predictions are only reused when every learner between ccb and gd is known to pass the features through.
+bool can_reuse_slot_invariant_predictions(const VW::LEARNER::learner& base)
+{
+  static const char* const feature_preserving[] = {"shared_feature_merger", "cb_sample", "cb_explore_adf_greedy",
+      "cb_explore_adf_softmax", "cb_explore_adf_first", "cb_explore_adf_bag", "cb_explore_adf_cover",
+      "cb_explore_adf_regcb", "cb_explore_adf_squarecb", "cb_adf", "csoaa_ldf", "scorer", "generate_interactions"};
+  for (const auto* l = &base; l != nullptr; l = l->get_base_learner())
+  {
+    const auto& name = l->get_name();
+    if (l->get_base_learner() == nullptr) { return name == "gd"; }
+    if (std::none_of(std::begin(feature_preserving), std::end(feature_preserving),
+            [&name](const char* prefix) { return name.compare(0, std::strlen(prefix), prefix) == 0; }))
+    {
+      return false;
+    }
+  }
+  return false;
+}
+
 // build a cb example from the ccb example
 template <bool is_learn>
 void build_cb_example(VW::multi_ex& cb_ex, VW::example* slot, const VW::ccb_label& ccb_label, ccb_data& data)
@@ -445,6 +506,15 @@ void learn_or_predict(ccb_data& data, learner& base, VW::multi_ex& examples)
   create_cb_labels(data);
   auto delete_cb_labels_guard = VW::scope_exit([&data] { delete_cb_labels(data); });
 
+  const bool reuse_slot_invariant_predictions =
+      !is_learn && data.reuse_slot_invariant_predictions && data.slots.size() > 1;
+  if (reuse_slot_invariant_predictions) { mark_slot_invariant_actions(data, should_augment_with_slot_info); }
+  auto unmark_actions_guard = VW::scope_exit(
+      [&data, reuse_slot_invariant_predictions]
+      {
+        if (reuse_slot_invariant_predictions) { unmark_slot_invariant_actions(data); }
+      });
+
   // this is temporary only so we can get some logging of what's going on
   try
   {
@@ -702,6 +772,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::ccb_explore_adf_setup(VW::
   }
 
   auto base = require_multiline(stack_builder.setup_base_learner());
+  data->reuse_slot_invariant_predictions = can_reuse_slot_invariant_predictions(*base);
 
   // Stash the base learners stride_shift so we can properly add a feature
   // later.
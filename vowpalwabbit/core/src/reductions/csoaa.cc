@@ -26,6 +26,8 @@ class csoaa
 public:
   uint32_t num_classes = 0;
   bool search = false;
+  bool sparse_class_index = false;  // score only the classes with weights on the example's features
+  VW::class_index::posting_lists class_index;
   VW::polyprediction* pred = nullptr;
   VW::io::logger logger;
   // Default value of 2 follows behavior of 1-indexing and can change to 0-indexing if detected
@@ -102,6 +104,10 @@ void predict_or_learn(csoaa& c, learner& base, VW::example& ec)
   // Guard VW::example state restore against throws
   auto restore_guard = VW::scope_exit([&ld, &ec] { ec.l.cs = std::move(ld); });
 
+  auto& classes = ec.ex_reduction_features.template get<VW::class_index::reduction_features>();
+  if (c.sparse_class_index) { classes.set(c.class_index, ec.ft_offset, c.num_classes, base.feature_width_below); }
+  auto class_index_guard = VW::scope_exit([&classes] { classes.reset_to_default(); });
+
   uint32_t prediction = (c.indexing == 0) ? 0 : 1;
   float score = FLT_MAX;
   size_t pt_start = ec.passthrough ? ec.passthrough->size() : 0;
@@ -186,6 +192,9 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::csoaa_setup(VW::setup_base
   option_group_definition new_options("[Reduction] Cost Sensitive One Against All");
   new_options
       .add(make_option("csoaa", c->num_classes).keep().necessary().help("One-against-all multiclass with <k> costs"))
+      .add(make_option("sparse_class_index", c->sparse_class_index)
+               .help("Keep per feature lists of the classes with non zero weights and only score those. Helps when "
+                     "most classes have no weight on the features of an example"))
       .add(make_option("indexing", all.runtime_state.indexing)
                .one_of({0, 1})
                .keep()
@@ -24,6 +24,7 @@
 #include "vw/io/logger.h"
 
 #include <algorithm>
+#include <array>
 #include <cfloat>
 #include <climits>
 #include <cmath>
@@ -81,7 +82,7 @@ emt_initial_type emt_initial_type_from_string(VW::string_view val)
   THROW(fmt::format("{} is not valid emt_initial_type", val));
 }
 
-float emt_initial(emt_initial_type initial_type, emt_feats f1, emt_feats f2)
+float emt_initial(emt_initial_type initial_type, const emt_feats& f1, const emt_feats& f2)
 {
   if (initial_type == emt_initial_type::GAUSSIAN) { return 1 - std::exp(-emt_norm(emt_scale_add(1, f1, -1, f2))); }
 
@@ -228,6 +229,28 @@ float emt_norm(const emt_feats& xs)
   return std::sqrt(sum_weights_sq);
 }
 
+uint64_t emt_sketch(const emt_feats& xs)
+{
+  // Each feature index is hashed into 64 random signs, one per hyperplane. A bit of the sketch is set when the
+  // example lies on the positive side of the corresponding hyperplane.
+  std::array<float, 64> projections{};
+  for (const auto& x : xs)
+  {
+    uint64_t signs = x.first + 0x9E3779B97F4A7C15ULL;
+    signs = (signs ^ (signs >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    signs = (signs ^ (signs >> 27)) * 0x94D049BB133111EBULL;
+    signs ^= signs >> 31;
+    for (size_t bit = 0; bit < 64; bit++) { projections[bit] += ((signs >> bit) & 1) ? x.second : -x.second; }
+  }
+
+  uint64_t sketch = 0;
+  for (size_t bit = 0; bit < 64; bit++)
+  {
+    if (projections[bit] > 0) { sketch |= uint64_t{1} << bit; }
+  }
+  return sketch;
+}
+
 void emt_scale(emt_feats& xs, float scalar)
 {
   for (auto& x : xs) { x.second *= scalar; }
@@ -639,6 +662,42 @@ void scorer_learn(learner& base, VW::example& ex, float label, float weight)
   }
 }
 
+uint32_t sketch_distance(uint64_t s1, uint64_t s2)
+{
+  uint64_t x = s1 ^ s2;
+  x = x - ((x >> 1) & 0x5555555555555555ULL);
+  x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+  x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return static_cast<uint32_t>((x * 0x0101010101010101ULL) >> 56);
+}
+
+// Fills b.candidates with the positions of the leaf memories which should be scored for ex. Without a candidate
+// limit this is every memory, otherwise it is the max_candidates memories whose sketches are closest to the sketch
+// of ex. Positions are kept in leaf order so ties are still broken by the leaf shuffle.
+const std::vector<size_t>& leaf_candidates(emt_tree& b, const emt_node& cn, const emt_example& ex)
+{
+  b.candidates.clear();
+
+  if (b.max_candidates == 0 || cn.examples.size() <= b.max_candidates)
+  {
+    for (size_t i = 0; i < cn.examples.size(); i++) { b.candidates.push_back(i); }
+    return b.candidates;
+  }
+
+  b.candidate_distances.clear();
+  for (size_t i = 0; i < cn.examples.size(); i++)
+  {
+    b.candidate_distances.emplace_back(sketch_distance(ex.sketch, cn.examples[i]->sketch), i);
+  }
+
+  auto nth = b.candidate_distances.begin() + b.max_candidates;
+  std::nth_element(b.candidate_distances.begin(), nth, b.candidate_distances.end());
+  for (auto it = b.candidate_distances.begin(); it != nth; ++it) { b.candidates.push_back(it->second); }
+  std::sort(b.candidates.begin(), b.candidates.end());
+
+  return b.candidates;
+}
+
 void scorer_learn(emt_tree& b, learner& base, emt_node& cn, const emt_example& ex, float weight)
 {
   // random and dist scorer has nothing to learn
@@ -658,29 +717,33 @@ void scorer_learn(emt_tree& b, learner& base, emt_node& cn, const emt_example& e
   float alternative_error = FLT_MAX;
   emt_example* alternative_ex = nullptr;
 
+  const auto& candidates = leaf_candidates(b, cn, ex);
+
   std::vector<float> scores;
-  for (auto& example : cn.examples) { scores.push_back(scorer_predict(b, base, ex, *example)); }
+  scores.reserve(candidates.size());
+  for (auto i : candidates) { scores.push_back(scorer_predict(b, base, ex, *cn.examples[i])); }
 
   // double loop has time complexity of 2n which is almost always faster than a sort with n*log(n)
-  for (size_t i = 0; i < cn.examples.size(); i++)
+  for (size_t c = 0; c < candidates.size(); c++)
   {
-    if (scores[i] < preferred_score)
+    if (scores[c] < preferred_score)
     {
-      preferred_score = scores[i];
-      preferred_ex = cn.examples[i].get();
+      preferred_score = scores[c];
+      preferred_ex = cn.examples[candidates[c]].get();
       preferred_error = (preferred_ex->label == ex.label) ? 0.f : 1.f;
     }
   }
 
-  for (size_t i = 0; i < cn.examples.size(); i++)
+  for (size_t c = 0; c < candidates.size(); c++)
   {
-    if (cn.examples[i].get() == preferred_ex) { continue; }
-    float error = (cn.examples[i].get()->label == ex.label) ? 0.f : 1.f;
+    emt_example* candidate = cn.examples[candidates[c]].get();
+    if (candidate == preferred_ex) { continue; }
+    float error = (candidate->label == ex.label) ? 0.f : 1.f;
 
-    if ((error < alternative_error) || (error == alternative_error && scores[i] < alternative_score))
+    if ((error < alternative_error) || (error == alternative_error && scores[c] < alternative_score))
     {
-      alternative_score = scores[i];
-      alternative_ex = cn.examples[i].get();
+      alternative_score = scores[c];
+      alternative_ex = candidate;
       alternative_error = error;
     }
   }
@@ -756,14 +819,14 @@ emt_example* node_pick(emt_tree& b, learner& base, emt_node& cn, const emt_examp
   // shuffle the examples to break ties randomly
   emt_shuffle(cn.examples.begin(), cn.examples.end(), *b.random_state);
 
-  for (auto const& example : cn.examples)
+  for (auto i : leaf_candidates(b, cn, ex))
   {
-    float score = scorer_predict(b, base, ex, *example);
+    float score = scorer_predict(b, base, ex, *cn.examples[i]);
 
     if (score < best_score)
     {
       best_score = score;
-      best_example = example.get();
+      best_example = cn.examples[i].get();
     }
   }
 
@@ -782,6 +845,7 @@ void emt_predict(emt_tree& b, learner& base, VW::example& ec)
 {
   b.all->feature_tweaks_config.ignore_some_linear = false;
   emt_example ex(*b.all, &ec);
+  if (b.max_candidates > 0) { ex.sketch = emt_sketch(ex.full); }
   emt_node& cn = *tree_route(b, ex);
   node_predict(b, base, cn, ex, ec);
 }
@@ -790,6 +854,7 @@ void emt_learn(emt_tree& b, learner& base, VW::example& ec)
 {
   b.all->feature_tweaks_config.ignore_some_linear = false;
   auto ex = VW::make_unique<emt_example>(*b.all, &ec);
+  if (b.max_candidates > 0) { ex->sketch = emt_sketch(ex->full); }
 
   emt_node& cn = *tree_route(b, *ex);
   node_predict(b, base, cn, *ex, ec);  // vw learners predict and emt_learn
@@ -900,10 +965,22 @@ size_t write_model_field(
 
 namespace
 {
+// Sketches are not saved in the model, so the loaded memories get theirs here when candidates are selected by sketch.
+void emt_sketch_memories(VW::reductions::eigen_memory_tree::emt_node& node)
+{
+  for (auto& ex : node.examples) { ex->sketch = VW::reductions::eigen_memory_tree::emt_sketch(ex->full); }
+  if (node.left != nullptr) { emt_sketch_memories(*node.left); }
+  if (node.right != nullptr) { emt_sketch_memories(*node.right); }
+}
+
 void emt_save_load_tree(VW::reductions::eigen_memory_tree::emt_tree& tree, VW::io_buf& io, bool read, bool text)
 {
   if (io.num_files() == 0) { return; }
-  if (read) { VW::model_utils::read_model_field(io, tree); }
+  if (read)
+  {
+    VW::model_utils::read_model_field(io, tree);
+    if (tree.max_candidates > 0) { emt_sketch_memories(*tree.root); }
+  }
   else { VW::model_utils::write_model_field(io, tree, "emt", text); }
 }
 }  // namespace
@@ -921,6 +998,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::eigen_memory_tree_setup(VW
   std::string initial_type;
   uint32_t tree_bound = 0;
   uint32_t leaf_split = 0;
+  uint32_t max_candidates = 0;
 
   option_group_definition new_options("[Reduction] Eigen Memory Tree");
   new_options.add(make_option("emt", enabled).keep().necessary().help("Make an eigen memory tree"))
@@ -946,7 +1024,13 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::eigen_memory_tree_setup(VW
                .keep()
                .one_of({"random", "eigen"})
                .default_value("eigen")
-               .help("Indicates the type of router to use"));
+               .help("Indicates the type of router to use"))
+      .add(make_option("emt_candidates", max_candidates)
+               .keep()
+               .default_value(0)
+               .experimental()
+               .help("Only score the memories of a leaf whose hashed sketches are closest to the example, at most this "
+                     "many. 0 scores every memory in the leaf"));
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
 
@@ -961,6 +1045,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::eigen_memory_tree_setup(VW
   auto t = VW::make_unique<VW::reductions::eigen_memory_tree::emt_tree>(&all, all.get_random_state(), leaf_split,
       emt_scorer_type_from_string(scorer_type), emt_router_type_from_string(router_type),
       emt_initial_type_from_string(initial_type), tree_bound);
+  t->max_candidates = max_candidates;
 
   auto l =
       make_reduction_learner(std::move(t), require_singleline(stack_builder.setup_base_learner()), emt_learn,
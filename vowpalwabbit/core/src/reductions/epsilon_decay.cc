@@ -12,6 +12,7 @@
 #include "vw/core/model_utils.h"
 #include "vw/core/multi_model_utils.h"
 #include "vw/core/prediction_type.h"
+#include "vw/core/scope_exit.h"
 #include "vw/core/vw.h"
 
 // TODO: delete this three includes
@@ -90,6 +91,10 @@ void epsilon_decay_data::update_weights(float init_ep, VW::LEARNER::learner& bas
 
     VW::action_scores champ_a_s;
 
+    // The models only differ by their weights, so gd can predict all of them in one pass over the features.
+    VW::reductions::multi_model::begin_fused_pass(examples, base, model_count, _fused_passes);
+    auto fused_pass_guard = VW::scope_exit([&examples] { VW::reductions::multi_model::end_fused_pass(examples); });
+
     // Process each model, then update the upper/lower bounds for each model
     for (int64_t model_ind = model_count - 1; model_ind >= 0; --model_ind)
     {
@@ -447,6 +452,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::epsilon_decay_setup(VW::se
 
   if (base->is_multiline())
   {
+    data->_fused_passes.can_fuse = VW::reductions::multi_model::can_fuse_models(*base);
     auto l = VW::LEARNER::make_reduction_learner(std::move(data), VW::LEARNER::require_multiline(base), learn, predict,
         stack_builder.get_setupfn_name(epsilon_decay_setup))
                  .set_input_label_type(VW::label_type_t::CB)
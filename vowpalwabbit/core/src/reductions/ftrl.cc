@@ -21,6 +21,11 @@
 #include <cmath>
 #include <string>
 
+#if !defined(VW_NO_INLINE_SIMD) && defined(__AVX2__)
+#  include <immintrin.h>
+#  define HAVE_FTRL_BLOCK_KERNELS
+#endif
+
 using namespace VW::LEARNER;
 using namespace VW::config;
 using namespace VW::math;
@@ -248,13 +253,215 @@ void inner_coin_betting_update_after_prediction(ftrl_update_data& d, float x, fl
   w[W_XT] /= d.average_squared_norm_x;
 }
 
+#ifdef HAVE_FTRL_BLOCK_KERNELS
+// With dense weights the features of an example are collected once and then processed eight at a time. The block
+// kernels do exactly the same float operations as the per feature functions above, in the same order, and the
+// predictions are still summed feature by feature, so they give the same results. A block whose features share a
+// weight is processed feature by feature since its updates have to be applied one after the other.
+inline void collect_feature(ftrl& b, float x, uint64_t index)
+{
+  b.feature_indices.push_back(index);
+  b.feature_values.push_back(x);
+}
+
+void collect_features(ftrl& b, VW::example& ec, size_t& num_features_from_interactions)
+{
+  b.feature_indices.clear();
+  b.feature_values.clear();
+  VW::foreach_feature<ftrl, uint64_t, collect_feature>(*b.all, ec, b, num_features_from_interactions);
+}
+
+template <void (*FuncT)(ftrl_update_data&, float, float&)>
+void foreach_collected_feature(ftrl& b, size_t begin, size_t end)
+{
+  auto& weights = b.all->weights.dense_weights;
+  for (size_t i = begin; i < end; ++i) { FuncT(b.data, b.feature_values[i], weights[b.feature_indices[i]]); }
+}
+
+// Compares the 8 masked indices against each other: every lane of the low half against the rotated high half, and
+// within each half against its rotations by one and two lanes.
+inline bool distinct_weights8(const uint64_t* indices, uint64_t mask)
+{
+  const __m256i vmask = _mm256_set1_epi64x(static_cast<int64_t>(mask));
+  const __m256i lo = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices)), vmask);
+  const __m256i hi = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + 4)), vmask);
+  const __m256i hi1 = _mm256_permute4x64_epi64(hi, 0x39);
+  const __m256i hi2 = _mm256_permute4x64_epi64(hi, 0x4e);
+  const __m256i hi3 = _mm256_permute4x64_epi64(hi, 0x93);
+  __m256i equal = _mm256_cmpeq_epi64(lo, hi);
+  equal = _mm256_or_si256(equal, _mm256_cmpeq_epi64(lo, hi1));
+  equal = _mm256_or_si256(equal, _mm256_cmpeq_epi64(lo, hi2));
+  equal = _mm256_or_si256(equal, _mm256_cmpeq_epi64(lo, hi3));
+  equal = _mm256_or_si256(equal, _mm256_cmpeq_epi64(lo, _mm256_permute4x64_epi64(lo, 0x39)));
+  equal = _mm256_or_si256(equal, _mm256_cmpeq_epi64(lo, _mm256_permute4x64_epi64(lo, 0x4e)));
+  equal = _mm256_or_si256(equal, _mm256_cmpeq_epi64(hi, hi1));
+  equal = _mm256_or_si256(equal, _mm256_cmpeq_epi64(hi, hi2));
+  return _mm256_testz_si256(equal, equal) != 0;
+}
+
+inline __m256 load_slot8(float* const* w, size_t slot)
+{
+  return _mm256_setr_ps(w[0][slot], w[1][slot], w[2][slot], w[3][slot], w[4][slot], w[5][slot], w[6][slot], w[7][slot]);
+}
+
+inline void store_slot8(float* const* w, size_t slot, __m256 v)
+{
+  alignas(32) float values[8];
+  _mm256_store_ps(values, v);
+  for (size_t j = 0; j < 8; ++j) { w[j][slot] = values[j]; }
+}
+
+inline __m256 abs8(__m256 v) { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), v); }
+
+// max_slot = x if x > max_slot, keeping max_slot for NaN like the scalar comparison does.
+inline __m256 raise_to8(__m256 max_slot, __m256 x)
+{
+  return _mm256_blendv_ps(max_slot, x, _mm256_cmp_ps(x, max_slot, _CMP_GT_OQ));
+}
+
+void update_proximal8(ftrl_update_data& d, __m256 x, float* const* w)
+{
+  const __m256 one = _mm256_set1_ps(1.f);
+  const __m256 alpha = _mm256_set1_ps(d.ftrl_alpha);
+  const __m256 l1 = _mm256_set1_ps(d.l1_lambda);
+  __m256 xt = load_slot8(w, W_XT);
+  __m256 zt = load_slot8(w, W_ZT);
+  const __m256 g2 = load_slot8(w, W_G2);
+
+  const __m256 gradient = _mm256_mul_ps(_mm256_set1_ps(d.update), x);
+  const __m256 ng2 = _mm256_add_ps(g2, _mm256_mul_ps(gradient, gradient));
+  const __m256 sqrt_ng2 = _mm256_sqrt_ps(ng2);
+  const __m256 sigma = _mm256_div_ps(_mm256_sub_ps(sqrt_ng2, _mm256_sqrt_ps(g2)), alpha);
+  zt = _mm256_add_ps(zt, _mm256_sub_ps(gradient, _mm256_mul_ps(sigma, xt)));
+  const __m256 flag = _mm256_blendv_ps(one, _mm256_set1_ps(-1.f), _mm256_cmp_ps(zt, _mm256_setzero_ps(), _CMP_LE_OQ));
+  const __m256 fabs_zt = _mm256_mul_ps(zt, flag);
+  const __m256 step = _mm256_div_ps(one,
+      _mm256_add_ps(_mm256_set1_ps(d.l2_lambda),
+          _mm256_div_ps(_mm256_add_ps(_mm256_set1_ps(d.ftrl_beta), sqrt_ng2), alpha)));
+  xt = _mm256_mul_ps(_mm256_mul_ps(step, flag), _mm256_sub_ps(l1, fabs_zt));
+  xt = _mm256_andnot_ps(_mm256_cmp_ps(fabs_zt, l1, _CMP_LE_OQ), xt);
+
+  store_slot8(w, W_XT, xt);
+  store_slot8(w, W_ZT, zt);
+  store_slot8(w, W_G2, ng2);
+}
+
+void update_pistol_state_and_predict8(ftrl_update_data& d, __m256 x, float* const* w)
+{
+  const __m256 mx = raise_to8(load_slot8(w, W_MX), abs8(x));
+  const __m256 zt = load_slot8(w, W_ZT);
+  const __m256 g2 = load_slot8(w, W_G2);
+
+  const __m256 squared_theta = _mm256_mul_ps(zt, zt);
+  const __m256 tmp = _mm256_div_ps(
+      _mm256_set1_ps(1.f), _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(d.ftrl_alpha), mx), _mm256_add_ps(g2, mx)));
+  alignas(32) float exps[8];
+  _mm256_store_ps(exps, _mm256_mul_ps(_mm256_div_ps(squared_theta, _mm256_set1_ps(2.f)), tmp));
+  for (float& e : exps) { e = VW::details::correctedExp(e); }
+  const __m256 xt = _mm256_mul_ps(
+      _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_sqrt_ps(g2), _mm256_set1_ps(d.ftrl_beta)), zt),
+          _mm256_load_ps(exps)),
+      tmp);
+
+  store_slot8(w, W_MX, mx);
+  store_slot8(w, W_XT, xt);
+  alignas(32) float predictions[8];
+  _mm256_store_ps(predictions, _mm256_mul_ps(xt, x));
+  for (float p : predictions) { d.predict += p; }
+}
+
+void coin_betting_predict8(ftrl_update_data& d, __m256 x, float* const* w)
+{
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 mx = raise_to8(load_slot8(w, W_MX), abs8(x));
+  const __m256 mg_mx = _mm256_mul_ps(load_slot8(w, W_MG), mx);
+
+  __m256 xt = _mm256_mul_ps(_mm256_div_ps(_mm256_add_ps(_mm256_set1_ps(d.ftrl_alpha), load_slot8(w, W_WE)),
+                                _mm256_mul_ps(mg_mx, _mm256_add_ps(mg_mx, load_slot8(w, W_G2)))),
+      load_slot8(w, W_ZT));
+  xt = _mm256_and_ps(_mm256_cmp_ps(mg_mx, zero, _CMP_GT_OQ), xt);
+  const __m256 x_normalized = _mm256_div_ps(x, mx);
+  const __m256 squared = _mm256_and_ps(_mm256_cmp_ps(mx, zero, _CMP_GT_OQ), _mm256_mul_ps(x_normalized, x_normalized));
+
+  alignas(32) float predictions[8];
+  alignas(32) float squared_norms[8];
+  _mm256_store_ps(predictions, _mm256_mul_ps(xt, x));
+  _mm256_store_ps(squared_norms, squared);
+  for (size_t j = 0; j < 8; ++j)
+  {
+    d.predict += predictions[j];
+    d.normalized_squared_norm_x += squared_norms[j];
+  }
+}
+
+void coin_betting_update8(ftrl_update_data& d, __m256 x, float* const* w)
+{
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 gradient = _mm256_mul_ps(_mm256_set1_ps(d.update), x);
+  const __m256 negative_gradient = _mm256_xor_ps(gradient, _mm256_set1_ps(-0.f));
+  const __m256 mx = raise_to8(load_slot8(w, W_MX), abs8(x));
+
+  const float fabs_gradient = std::fabs(d.update);
+  const float raised_mg = fabs_gradient > d.ftrl_beta ? fabs_gradient : d.ftrl_beta;
+  __m256 mg = load_slot8(w, W_MG);
+  mg = _mm256_blendv_ps(mg, _mm256_set1_ps(raised_mg), _mm256_cmp_ps(_mm256_set1_ps(fabs_gradient), mg, _CMP_GT_OQ));
+
+  const __m256 mg_mx = _mm256_mul_ps(mg, mx);
+  const __m256 g2 = load_slot8(w, W_G2);
+  const __m256 zt = load_slot8(w, W_ZT);
+  const __m256 we = load_slot8(w, W_WE);
+  __m256 xt = _mm256_mul_ps(
+      _mm256_div_ps(_mm256_add_ps(_mm256_set1_ps(d.ftrl_alpha), we), _mm256_mul_ps(mg_mx, _mm256_add_ps(mg_mx, g2))),
+      zt);
+  xt = _mm256_and_ps(_mm256_cmp_ps(mg_mx, zero, _CMP_GT_OQ), xt);
+
+  store_slot8(w, W_MX, mx);
+  store_slot8(w, W_MG, mg);
+  store_slot8(w, W_ZT, _mm256_add_ps(zt, negative_gradient));
+  store_slot8(w, W_G2, _mm256_add_ps(g2, abs8(gradient)));
+  store_slot8(w, W_WE, _mm256_add_ps(we, _mm256_mul_ps(negative_gradient, xt)));
+  store_slot8(w, W_XT, _mm256_div_ps(xt, _mm256_set1_ps(d.average_squared_norm_x)));
+}
+
+template <void (*FuncT)(ftrl_update_data&, float, float&), void (*BlockT)(ftrl_update_data&, __m256, float* const*)>
+void foreach_collected_feature_block(ftrl& b)
+{
+  size_t i = 0;
+  auto& weights = b.all->weights.dense_weights;
+  const uint64_t mask = weights.mask();
+  for (; i + 8 <= b.feature_indices.size(); i += 8)
+  {
+    if (!distinct_weights8(&b.feature_indices[i], mask))
+    {
+      foreach_collected_feature<FuncT>(b, i, i + 8);
+      continue;
+    }
+    float* w[8];
+    for (size_t j = 0; j < 8; ++j) { w[j] = &weights[b.feature_indices[i + j]]; }
+    BlockT(b.data, _mm256_loadu_ps(&b.feature_values[i]), w);
+  }
+  foreach_collected_feature<FuncT>(b, i, b.feature_indices.size());
+}
+#endif
+
 void coin_betting_predict(ftrl& b, VW::example& ec)
 {
   b.data.predict = 0;
   b.data.normalized_squared_norm_x = 0;
 
   size_t num_features_from_interactions = 0;
-  VW::foreach_feature<ftrl_update_data, inner_coin_betting_predict>(*b.all, ec, b.data, num_features_from_interactions);
+#ifdef HAVE_FTRL_BLOCK_KERNELS
+  if (!b.all->weights.sparse)
+  {
+    collect_features(b, ec, num_features_from_interactions);
+    foreach_collected_feature_block<inner_coin_betting_predict, coin_betting_predict8>(b);
+  }
+  else
+#endif
+  {
+    VW::foreach_feature<ftrl_update_data, inner_coin_betting_predict>(
+        *b.all, ec, b.data, num_features_from_interactions);
+  }
   ec.num_features_from_interactions = num_features_from_interactions;
 
   b.gd_per_model_states[0].normalized_sum_norm_x += (static_cast<double>(ec.weight)) * b.data.normalized_squared_norm_x;
@@ -272,8 +479,18 @@ void update_state_and_predict_pistol(ftrl& b, VW::example& ec)
   b.data.predict = 0;
 
   size_t num_features_from_interactions = 0;
-  VW::foreach_feature<ftrl_update_data, inner_update_pistol_state_and_predict>(
-      *b.all, ec, b.data, num_features_from_interactions);
+#ifdef HAVE_FTRL_BLOCK_KERNELS
+  if (!b.all->weights.sparse)
+  {
+    collect_features(b, ec, num_features_from_interactions);
+    foreach_collected_feature_block<inner_update_pistol_state_and_predict, update_pistol_state_and_predict8>(b);
+  }
+  else
+#endif
+  {
+    VW::foreach_feature<ftrl_update_data, inner_update_pistol_state_and_predict>(
+        *b.all, ec, b.data, num_features_from_interactions);
+  }
   ec.num_features_from_interactions = num_features_from_interactions;
 
   ec.partial_prediction = b.data.predict;
@@ -284,21 +501,49 @@ void update_after_prediction_proximal(ftrl& b, VW::example& ec)
 {
   b.data.update =
       b.all->loss_config.loss->first_derivative(b.all->sd.get(), ec.pred.scalar, ec.l.simple.label) * ec.weight;
-  VW::foreach_feature<ftrl_update_data, inner_update_proximal>(*b.all, ec, b.data);
+#ifdef HAVE_FTRL_BLOCK_KERNELS
+  if (!b.all->weights.sparse)
+  {
+    size_t num_features_from_interactions = 0;
+    collect_features(b, ec, num_features_from_interactions);
+    foreach_collected_feature_block<inner_update_proximal, update_proximal8>(b);
+  }
+  else
+#endif
+  {
+    VW::foreach_feature<ftrl_update_data, inner_update_proximal>(*b.all, ec, b.data);
+  }
 }
 
 void update_after_prediction_pistol(ftrl& b, VW::example& ec)
 {
   b.data.update =
       b.all->loss_config.loss->first_derivative(b.all->sd.get(), ec.pred.scalar, ec.l.simple.label) * ec.weight;
-  VW::foreach_feature<ftrl_update_data, inner_update_pistol_post>(*b.all, ec, b.data);
+#ifdef HAVE_FTRL_BLOCK_KERNELS
+  // The features were collected by update_state_and_predict_pistol.
+  if (!b.all->weights.sparse) { foreach_collected_feature<inner_update_pistol_post>(b, 0, b.feature_indices.size()); }
+  else
+#endif
+  {
+    VW::foreach_feature<ftrl_update_data, inner_update_pistol_post>(*b.all, ec, b.data);
+  }
 }
 
 void coin_betting_update_after_prediction(ftrl& b, VW::example& ec)
 {
   b.data.update =
       b.all->loss_config.loss->first_derivative(b.all->sd.get(), ec.pred.scalar, ec.l.simple.label) * ec.weight;
-  VW::foreach_feature<ftrl_update_data, inner_coin_betting_update_after_prediction>(*b.all, ec, b.data);
+#ifdef HAVE_FTRL_BLOCK_KERNELS
+  // The features were collected by coin_betting_predict.
+  if (!b.all->weights.sparse)
+  {
+    foreach_collected_feature_block<inner_coin_betting_update_after_prediction, coin_betting_update8>(b);
+  }
+  else
+#endif
+  {
+    VW::foreach_feature<ftrl_update_data, inner_coin_betting_update_after_prediction>(*b.all, ec, b.data);
+  }
 }
 
 template <bool audit>
@@ -15,7 +15,10 @@
 #include "vw/core/setup_base.h"
 
 #include <algorithm>
+#include <array>
+#include <bitset>
 #include <cfloat>
+#include <future>
 
 #if !defined(VW_NO_INLINE_SIMD)
 #  if !defined(__SSE2__) && (defined(_M_AMD64) || defined(_M_X64))
@@ -30,11 +33,14 @@
 #endif
 
 #include "vw/core/accumulate.h"
+#include "vw/core/class_index_reduction_features.h"
 #include "vw/core/debug_log.h"
 #include "vw/core/label_parser.h"
 #include "vw/core/model_utils.h"
+#include "vw/core/multi_model_reduction_features.h"
 #include "vw/core/parse_regressor.h"
 #include "vw/core/shared_data.h"
+#include "vw/core/thread_pool.h"
 #include "vw/core/vw.h"
 #include "vw/core/vw_versions.h"
 
@@ -50,10 +56,46 @@ namespace
 constexpr double L1_STATE_DEFAULT = 0.;
 constexpr double L2_STATE_DEFAULT = 1.;
 
-template <typename WeightsT>
-void merge_weights_simple(size_t length, const std::vector<std::reference_wrapper<const WeightsT>>& source,
-    const std::vector<float>& per_model_weighting, WeightsT& weights)
+// Weights are merged elementwise, so the weight range is split into blocks. A block is small enough for its output to
+// stay in cache while every source model is added to it, and since each element sees the sources in the same order the
+// result does not depend on the number of threads the blocks are shared between.
+constexpr size_t MERGE_BLOCK_SIZE = 1 << 14;
+
+template <typename MergeBlockT>
+void merge_in_blocks(size_t num_threads, size_t length, const MergeBlockT& merge_block)
+{
+  const size_t num_blocks = (length + MERGE_BLOCK_SIZE - 1) / MERGE_BLOCK_SIZE;
+  auto merge_blocks = [length, &merge_block](size_t first, size_t last)
+  {
+    for (size_t block = first; block < last; block++)
+    {
+      merge_block(block * MERGE_BLOCK_SIZE, std::min(length, (block + 1) * MERGE_BLOCK_SIZE));
+    }
+  };
+
+  num_threads = std::min(num_threads, num_blocks);
+  if (num_threads <= 1)
+  {
+    merge_blocks(0, num_blocks);
+    return;
+  }
+
+  VW::thread_pool pool(num_threads);
+  std::vector<std::future<void>> futures;
+  futures.reserve(num_threads);
+  for (size_t t = 0; t < num_threads; t++)
+  {
+    const size_t first = num_blocks * t / num_threads;
+    const size_t last = num_blocks * (t + 1) / num_threads;
+    futures.emplace_back(pool.submit([&merge_blocks, first, last]() { merge_blocks(first, last); }));
+  }
+  for (auto& f : futures) { f.get(); }
+}
+
+void merge_weights_simple(size_t length, const std::vector<std::reference_wrapper<const VW::sparse_parameters>>& source,
+    const std::vector<float>& per_model_weighting, VW::sparse_parameters& weights)
 {
+  // Sparse weights insert on lookup, so they are merged on this thread.
   for (size_t i = 0; i < source.size(); i++)
   {
     const auto& this_source = source[i].get();
@@ -64,35 +106,67 @@ void merge_weights_simple(size_t length, const std::vector<std::reference_wrappe
   }
 }
 
+void merge_weights_simple(size_t length, const std::vector<std::reference_wrapper<const VW::dense_parameters>>& source,
+    const std::vector<float>& per_model_weighting, VW::dense_parameters& weights, size_t num_threads)
+{
+  merge_in_blocks(num_threads, length,
+      [&source, &per_model_weighting, &weights](size_t begin, size_t end)
+      {
+        for (size_t i = 0; i < source.size(); i++)
+        {
+          const auto& this_source = source[i].get();
+          for (size_t j = begin; j < end; j++)
+          {
+            weights.strided_index(j) += (this_source.strided_index(j) * per_model_weighting[i]);
+          }
+        }
+      });
+}
+
 void merge_weights_with_save_resume(size_t length,
     const std::vector<std::reference_wrapper<const VW::dense_parameters>>& source,
     const std::vector<float>& /*per_model_weighting*/, VW::workspace& output_workspace, VW::dense_parameters& weights)
 {
-  // Adaptive totals
-  std::vector<float> adaptive_totals(length, 0.f);
-  for (const auto& model : source)
-  {
-    const auto& this_model = model.get();
-    for (size_t i = 0; i < length; i++) { adaptive_totals[i] += (&(this_model[i << weights.stride_shift()]))[1]; }
-  }
-
-  std::vector<VW::dense_parameters> weight_copies;
-  weight_copies.reserve(source.size());
-  for (auto i : source)
-  {
-    // There is no copy constructor for weights, so we have to copy manually.
-    weight_copies.emplace_back(VW::dense_parameters::deep_copy(i));
-    VW::details::do_weighting(
-        output_workspace.initial_weights_config.normalized_idx, length, adaptive_totals.data(), weight_copies.back());
-  }
+  // Each source is reweighted by its share of the adaptive totals as it is accumulated, instead of being copied and
+  // reweighted first, so the merge needs no memory beyond the output.
+  const size_t normalized_idx = output_workspace.initial_weights_config.normalized_idx;
+  const uint64_t stride = static_cast<uint64_t>(1) << weights.stride_shift();
+  merge_in_blocks(output_workspace.runtime_state.merge_threads, length,
+      [&source, &weights, normalized_idx, stride](size_t begin, size_t end)
+      {
+        // Adaptive totals
+        std::vector<float> adaptive_totals(end - begin, 0.f);
+        for (const auto& model : source)
+        {
+          const auto& this_model = model.get();
+          for (size_t i = begin; i < end; i++) { adaptive_totals[i - begin] += (&this_model.strided_index(i))[1]; }
+        }
 
-  // Weights have already been reweighted, so just accumulate.
-  for (const auto& this_source : weight_copies)
-  {
-    // Intentionally add irrespective of stride.
-    const auto full_weights_size = length << weights.stride_shift();
-    for (uint64_t i = 0; i < full_weights_size; i++) { weights[i] += this_source[i]; }
-  }
+        for (const auto& model : source)
+        {
+          const auto& this_model = model.get();
+          for (size_t i = begin; i < end; i++)
+          {
+            const float* source_weight = &this_model.strided_index(i);
+            float* weight = &weights.strided_index(i);
+            const float total = adaptive_totals[i - begin];
+            // Same reweighting as VW::details::do_weighting.
+            const float ratio = total > 0 ? source_weight[1] / total : 0.f;
+            for (uint64_t k = 0; k < stride; k++)
+            {
+              float value = source_weight[k];
+              if (total > 0)
+              {
+                if (k == 0 || k == 1) { value *= ratio; }
+                if (normalized_idx > 0 && k == normalized_idx) { value *= ratio; }
+              }
+              else if (k == 0) { value = 0; }
+              // Intentionally add irrespective of stride.
+              weight[k] += value;
+            }
+          }
+        }
+      });
 }
 
 template <typename WeightsT>
@@ -233,7 +307,11 @@ void merge(const std::vector<float>& per_model_weighting, const std::vector<cons
       merge_weights_with_save_resume(
           length, source, per_model_weighting, output_workspace, output_workspace.weights.dense_weights);
     }
-    else { merge_weights_simple(length, source, per_model_weighting, output_workspace.weights.dense_weights); }
+    else
+    {
+      merge_weights_simple(length, source, per_model_weighting, output_workspace.weights.dense_weights,
+          output_workspace.runtime_state.merge_threads);
+    }
   }
 
   for (size_t i = 0; i < output_data.gd_per_model_states.size(); i++)
@@ -469,6 +547,181 @@ inline float trunc_predict(VW::workspace& all, VW::example& ec, double gravity,
   return temp.prediction;
 }
 
+class fused_predict_data
+{
+public:
+  float* predictions;
+  size_t count;
+  size_t step;
+  const VW::dense_parameters& weights;
+};
+
+inline void vec_add_fused(fused_predict_data& d, const float fx, uint64_t fi)
+{
+  for (size_t c = 0; c < d.count; c++) { d.predictions[c] += fx * d.weights[fi + c * d.step]; }
+}
+
+// Within a fused multi-model pass every model sees the same features. The first prediction of an example computes the
+// raw predictions of all models in one traversal of the features, the other models reuse theirs until gd updates their
+// weights. Returns false when ec is not part of a fused pass, in which case nothing is done.
+bool fused_predict(VW::reductions::gd& g, VW::example& ec, size_t& num_interacted_features)
+{
+  const auto& pass = ec.ex_reduction_features.template get<VW::multi_model::reduction_features>();
+  VW::workspace& all = *g.all;
+  auto& cache = g.fused_predictions;
+  if (!pass.fused() || all.weights.sparse || ec.ft_offset < pass.base_offset) { return false; }
+  const uint64_t distance = ec.ft_offset - pass.base_offset;
+  const size_t model = distance / pass.model_step;
+  auto model_index = [&](size_t m) { return (pass.base_offset + m * pass.model_step) >> all.weights.stride_shift(); };
+  if (distance % pass.model_step != 0 || model >= pass.model_count ||
+      model_index(pass.model_count - 1) >= cache.model_generations.size())
+  {
+    return false;
+  }
+  auto generation = [&](size_t m) { return cache.model_generations[model_index(m)]; };
+
+  if (cache.pass_id != pass.pass_id)
+  {
+    cache.pass_id = pass.pass_id;
+    cache.index.clear();
+  }
+
+  const float initial = ec.ex_reduction_features.template get<VW::simple_label_reduction_features>().initial;
+  size_t num_features = 0;
+  for (const auto& fs : ec) { num_features += fs.size(); }
+
+  auto slot = cache.index.emplace(&ec, cache.index.size());
+  if (slot.first->second == cache.entries.size()) { cache.entries.emplace_back(); }
+  auto& entry = cache.entries[slot.first->second];
+
+  if (slot.second)
+  {
+    entry.initial = initial;
+    entry.num_features = num_features;
+    entry.interactions = ec.interactions;
+    entry.predictions.assign(pass.model_count, initial);
+    entry.generations.resize(pass.model_count);
+    for (size_t m = 0; m < pass.model_count; m++) { entry.generations[m] = generation(m); }
+
+    fused_predict_data data = {entry.predictions.data(), pass.model_count, pass.model_step, all.weights.dense_weights};
+    const uint64_t ft_offset = ec.ft_offset;
+    ec.ft_offset = pass.base_offset;
+    entry.num_interacted_features = 0;
+    VW::foreach_feature<fused_predict_data, uint64_t, vec_add_fused, VW::dense_parameters>(all.weights.dense_weights,
+        all.feature_tweaks_config.ignore_some_linear, all.feature_tweaks_config.ignore_linear, *ec.interactions,
+        *ec.extent_interactions, all.feature_tweaks_config.permutations, ec, data, entry.num_interacted_features,
+        all.runtime_state.generate_interactions_object_cache_state);
+    ec.ft_offset = ft_offset;
+  }
+  else if (entry.initial != initial || entry.num_features != num_features || entry.interactions != ec.interactions)
+  {
+    // The example changed since the other models were predicted, so only this model can be served from now on.
+    entry.initial = initial;
+    entry.num_features = num_features;
+    entry.interactions = ec.interactions;
+    std::fill(entry.generations.begin(), entry.generations.end(), UINT64_MAX);
+    entry.predictions[model] = inline_predict(all, ec, entry.num_interacted_features);
+    entry.generations[model] = generation(model);
+  }
+  else if (entry.generations[model] != generation(model))
+  {
+    // Only this model was updated, recomputing it alone is cheaper than recomputing all of them.
+    entry.predictions[model] = inline_predict(all, ec, entry.num_interacted_features);
+    entry.generations[model] = generation(model);
+  }
+
+  ec.partial_prediction = entry.predictions[model];
+  num_interacted_features = entry.num_interacted_features;
+  return true;
+}
+
+inline VW::namespace_index term_namespace(VW::namespace_index term) { return term; }
+inline VW::namespace_index term_namespace(const VW::extent_term& term) { return term.first; }
+
+template <typename TermT>
+void split_interactions(const std::vector<std::vector<TermT>>& interactions,
+    const std::bitset<VW::NUM_NAMESPACES>& slot_namespaces, std::vector<std::vector<TermT>>& invariant,
+    std::vector<std::vector<TermT>>& per_slot)
+{
+  size_t num_invariant = 0;
+  size_t num_per_slot = 0;
+  for (const auto& interaction : interactions)
+  {
+    const bool varies = std::any_of(interaction.begin(), interaction.end(),
+        [&slot_namespaces](const TermT& term) { return slot_namespaces[term_namespace(term)]; });
+    auto& out = varies ? per_slot : invariant;
+    auto& count = varies ? num_per_slot : num_invariant;
+    if (count == out.size()) { out.emplace_back(); }
+    out[count++] = interaction;
+  }
+  invariant.resize(num_invariant);
+  per_slot.resize(num_per_slot);
+}
+
+// While ccb predicts the slots of a decision only the features of the slot namespaces change. The linear terms and
+// interactions which do not involve them are computed once per example and decision, and every slot only adds the
+// terms which do. Returns false when ec is not predicted as part of a ccb decision, in which case nothing is done.
+bool slot_invariant_predict(VW::reductions::gd& g, VW::example& ec, size_t& num_interacted_features)
+{
+  const auto& ccb = ec.ex_reduction_features.template get<VW::ccb_reduction_features>();
+  VW::workspace& all = *g.all;
+  if (ccb.decision_id == 0 || all.weights.sparse) { return false; }
+
+  auto& cache = g.slot_invariant_predictions;
+  if (cache.decision_id != ccb.decision_id)
+  {
+    cache.decision_id = ccb.decision_id;
+    cache.entries.clear();
+    cache.split_interactions_source = nullptr;
+    for (size_t ns = 0; ns < VW::NUM_NAMESPACES; ns++)
+    {
+      const bool ignored = all.feature_tweaks_config.ignore_some_linear && all.feature_tweaks_config.ignore_linear[ns];
+      cache.ignore_invariant_linear[ns] = ignored || ccb.slot_namespaces[ns];
+      cache.ignore_slot_linear[ns] = ignored || !ccb.slot_namespaces[ns];
+    }
+  }
+
+  // The interactions of an example are generated from its namespaces, so the split only has to be redone when these
+  // change.
+  if (cache.split_interactions_source != ec.interactions ||
+      cache.split_extent_interactions_source != ec.extent_interactions ||
+      ec.indices.size() != cache.split_indices.size() ||
+      !std::equal(ec.indices.begin(), ec.indices.end(), cache.split_indices.begin()))
+  {
+    cache.split_interactions_source = ec.interactions;
+    cache.split_extent_interactions_source = ec.extent_interactions;
+    cache.split_indices.assign(ec.indices.begin(), ec.indices.end());
+    split_interactions(*ec.interactions, ccb.slot_namespaces, cache.invariant_interactions, cache.slot_interactions);
+    split_interactions(*ec.extent_interactions, ccb.slot_namespaces, cache.invariant_extent_interactions,
+        cache.slot_extent_interactions);
+  }
+
+  size_t num_invariant_features = 0;
+  for (auto it = ec.begin(); it != ec.end(); ++it)
+  {
+    if (!ccb.slot_namespaces[it.index()]) { num_invariant_features += (*it).size(); }
+  }
+
+  auto& entry = cache.entries[&ec];
+  if (entry.num_features != num_invariant_features || entry.ft_offset != ec.ft_offset || entry.num_features == 0)
+  {
+    entry.ft_offset = ec.ft_offset;
+    entry.num_features = num_invariant_features;
+    entry.num_interacted_features = 0;
+    entry.prediction = VW::inline_predict(all.weights.dense_weights, true, cache.ignore_invariant_linear,
+        cache.invariant_interactions, cache.invariant_extent_interactions, all.feature_tweaks_config.permutations, ec,
+        entry.num_interacted_features, all.runtime_state.generate_interactions_object_cache_state);
+  }
+
+  const float initial = ec.ex_reduction_features.template get<VW::simple_label_reduction_features>().initial;
+  num_interacted_features = entry.num_interacted_features;
+  ec.partial_prediction = entry.prediction +
+      VW::inline_predict(all.weights.dense_weights, true, cache.ignore_slot_linear, cache.slot_interactions,
+          cache.slot_extent_interactions, all.feature_tweaks_config.permutations, ec, num_interacted_features,
+          all.runtime_state.generate_interactions_object_cache_state, initial);
+  return true;
+}
+
 template <bool l1, bool audit>
 void predict(VW::reductions::gd& g, VW::example& ec)
 {
@@ -477,7 +730,11 @@ void predict(VW::reductions::gd& g, VW::example& ec)
   VW::workspace& all = *g.all;
   size_t num_interacted_features = 0;
   if (l1) { ec.partial_prediction = trunc_predict(all, ec, all.sd->gravity, num_interacted_features); }
-  else { ec.partial_prediction = inline_predict(all, ec, num_interacted_features); }
+  else if (audit ||
+      (!fused_predict(g, ec, num_interacted_features) && !slot_invariant_predict(g, ec, num_interacted_features)))
+  {
+    ec.partial_prediction = inline_predict(all, ec, num_interacted_features);
+  }
 
   ec.num_features_from_interactions = num_interacted_features;
   ec.partial_prediction *= static_cast<float>(all.sd->contraction);
@@ -499,6 +756,72 @@ inline void vec_add_trunc_multipredict(VW::details::multipredict_info<T>& mp, co
   }
 }
 
+class class_index_predict_data
+{
+public:
+  VW::class_index::posting_lists& index;
+  size_t count;
+  size_t step;
+  VW::polyprediction* pred;
+  const VW::dense_parameters& weights;
+  float gravity;
+};
+
+template <bool l1>
+inline void vec_add_class_index(class_index_predict_data& d, const float fx, uint64_t fi)
+{
+  if ((-1e-10 < fx) && (fx < 1e-10)) { return; }
+  fi &= d.weights.mask();
+  auto it = d.index.classes.find(fi);
+  if (it == d.index.classes.end())
+  {
+    it = d.index.classes.emplace(fi, std::vector<uint32_t>()).first;
+    for (size_t c = 0; c < d.count; c++)
+    {
+      if (d.weights[fi + c * d.step] != 0.f) { it->second.push_back(static_cast<uint32_t>(c)); }
+    }
+  }
+  for (const auto c : it->second)
+  {
+    if (c >= d.count) { break; }
+    const float w = d.weights[fi + c * d.step];
+    d.pred[c].scalar += fx * (l1 ? VW::trunc_weight(w, d.gravity) : w);
+  }
+}
+
+class class_index_learn_data
+{
+public:
+  VW::class_index::posting_lists& index;
+  uint64_t class_offset;
+  uint64_t mask;
+  uint32_t trained_class;
+};
+
+inline void add_trained_class(class_index_learn_data& d, const float, uint64_t fi)
+{
+  auto it = d.index.classes.find((fi - d.class_offset) & d.mask);
+  if (it == d.index.classes.end()) { return; }
+  auto& classes = it->second;
+  auto pos = std::lower_bound(classes.begin(), classes.end(), d.trained_class);
+  if (pos == classes.end() || *pos != d.trained_class) { classes.insert(pos, d.trained_class); }
+}
+
+// Called after gd changed the weights of ec. Lists which do not exist yet are built from the weights when first needed,
+// so only the existing lists of the example's features have to learn about the trained class.
+void update_class_index(VW::workspace& all, VW::example& ec)
+{
+  const auto& classes = ec.ex_reduction_features.template get<VW::class_index::reduction_features>();
+  if (!classes.active() || all.weights.sparse || ec.ft_offset < classes.base_offset) { return; }
+  const uint64_t distance = ec.ft_offset - classes.base_offset;
+  if (distance % classes.class_step != 0 || distance / classes.class_step >= classes.class_count) { return; }
+
+  class_index_learn_data data = {*classes.index, distance, all.weights.mask(),
+      static_cast<uint32_t>(distance / classes.class_step)};
+  size_t num_interacted_features = 0;
+  VW::foreach_feature<class_index_learn_data, uint64_t, add_trained_class>(all, ec, data, num_interacted_features);
+}
+
 template <bool l1, bool audit>
 void multipredict(VW::reductions::gd& g, VW::example& ec, size_t count, size_t step, VW::polyprediction* pred,
     bool finalize_predictions)
@@ -511,7 +834,17 @@ void multipredict(VW::reductions::gd& g, VW::example& ec, size_t count, size_t s
   }
 
   size_t num_features_from_interactions = 0;
-  if (g.all->weights.sparse)
+  const auto& classes = ec.ex_reduction_features.template get<VW::class_index::reduction_features>();
+  if (!audit && classes.active() && !g.all->weights.sparse && classes.base_offset == ec.ft_offset &&
+      classes.class_step == step && classes.class_count == count)
+  {
+    // Classes without a weight on any of the features keep the initial prediction.
+    class_index_predict_data data = {
+        *classes.index, count, step, pred, g.all->weights.dense_weights, static_cast<float>(all.sd->gravity)};
+    VW::foreach_feature<class_index_predict_data, uint64_t, vec_add_class_index<l1>>(
+        all, ec, data, num_features_from_interactions);
+  }
+  else if (g.all->weights.sparse)
   {
     VW::details::multipredict_info<VW::sparse_parameters> mp = {
         count, step, pred, g.all->weights.sparse_weights, static_cast<float>(all.sd->gravity)};
@@ -802,11 +1135,16 @@ void update(VW::reductions::gd& g, VW::example& ec)
            g, ec)) != 0.)
   {
     train<sqrt_rate, feature_mask_off, adaptive, normalized, spare>(g, ec, update);
+    update_class_index(*g.all, ec);
+    auto& generations = g.fused_predictions.model_generations;
+    const uint64_t model_index = ec.ft_offset >> g.all->weights.stride_shift();
+    if (model_index < generations.size()) { generations[model_index]++; }
   }
 
   if (g.all->sd->contraction < 1e-9 || g.all->sd->gravity > 1e3)
   {  // updating weights now to avoid numerical instability
     sync_weights(*g.all);
+    for (auto& generation : g.fused_predictions.model_generations) { generation++; }
   }
   g.current_model_state = nullptr;
 }
@@ -870,7 +1208,7 @@ void save_load_regressor(VW::workspace& all, VW::io_buf& model_file, bool read,
   {
     std::stringstream msg;
 
-    for (auto it = weights.begin(); it != weights.end(); ++it)
+    for (auto it = weights.cbegin(); it != weights.cend(); ++it)
     {
       const auto weight_value = *it;
       if (*it != 0.f)
@@ -916,7 +1254,7 @@ void save_load_regressor(VW::workspace& all, VW::io_buf& model_file, bool read,
   }
   else  // write
   {
-    for (typename T::iterator v = weights.begin(); v != weights.end(); ++v)
+    for (typename T::const_iterator v = weights.cbegin(); v != weights.cend(); ++v)
     {
       if (*v != 0.)
       {
@@ -933,6 +1271,7 @@ void save_load_regressor(VW::workspace& all, VW::io_buf& model_file, bool read,
 
 void VW::details::save_load_regressor_gd(VW::workspace& all, VW::io_buf& model_file, bool read, bool text)
 {
+  if (all.runtime_state.skip_weights_save_load) { return; }
   if (all.weights.sparse) { ::save_load_regressor(all, model_file, read, text, all.weights.sparse_weights); }
   else { ::save_load_regressor(all, model_file, read, text, all.weights.dense_weights); }
 }
@@ -991,7 +1330,7 @@ void save_load_online_state_weights(VW::workspace& all, VW::io_buf& model_file,
   {  // write binary or text
     if (all.output_config.hexfloat_weights && (text || all.output_config.print_invert)) { msg << std::hexfloat; }
 
-    for (typename T::iterator v = weights.begin(); v != weights.end(); ++v)
+    for (typename T::const_iterator v = weights.cbegin(); v != weights.cend(); ++v)
     {
       i = v.index() >> weights.stride_shift();
       bool gd_write = *v != 0.f;
@@ -1232,6 +1571,7 @@ void VW::details::save_load_online_state_gd(VW::workspace& all, VW::io_buf& mode
     all.sd->total_features = 0;
     all.passes_config.current_pass = 0;
   }
+  if (all.runtime_state.skip_weights_save_load) { return; }
   if (all.weights.sparse)
   {
     save_load_online_state_weights(all, model_file, read, text, g, msg, ftrl_size, all.weights.sparse_weights);
@@ -1244,7 +1584,8 @@ namespace
 void save_load(VW::reductions::gd& g, VW::io_buf& model_file, bool read, bool text)
 {
   VW::workspace& all = *g.all;
-  if (read)
+  // Delta checkpoints keep the weights themselves, so they must not be reinitialized when only the state is loaded.
+  if (read && !all.runtime_state.skip_weights_save_load)
   {
     VW::details::initialize_regressor(all);
 
@@ -17,9 +17,11 @@
 #include "vw/core/shared_data.h"
 #include "vw/core/simple_label.h"
 
+#include <algorithm>
 #include <cfloat>
 #include <cstdio>
 #include <fstream>
+#include <vector>
 
 using namespace VW::LEARNER;
 using namespace VW::config;
@@ -31,6 +33,10 @@ class gdmf
 public:
   VW::workspace* all = nullptr;  // regressor, printing
   VW::v_array<float> scalars;
+  // Scratch for the dot products of one namespace pair with the left and right factors.
+  std::vector<float> left_dots;
+  std::vector<float> right_dots;
+  std::vector<float> factor_updates;
   uint32_t rank = 0;
   size_t no_win_counter = 0;
   uint64_t early_stop_thres = 0;
@@ -91,14 +97,33 @@ void mf_print_audit_features(gdmf& d, VW::example& ec, size_t offset)
   mf_print_offset_features(d, ec, offset);
 }
 
-class pred_offset
+// The rank factors of a feature are stored next to each other, factor k at weight offset offset + k. Computing the dot
+// product of the namespace with every factor in one sweep reads each feature's factors contiguously instead of
+// passing over the namespace once per factor.
+template <class T>
+void factor_dots(T& weights, const VW::features& fs, uint64_t offset, uint32_t rank, float* dots)
 {
-public:
-  float p;
-  uint64_t offset;
-};
+  std::fill(dots, dots + rank, 0.f);
+  for (size_t i = 0; i < fs.size(); i++)
+  {
+    const float x = fs.values[i];
+    const float* w = &weights[fs.indices[i]] + offset;
+    for (uint32_t k = 0; k < rank; k++) { dots[k] += w[k] * x; }
+  }
+}
 
-void offset_add(pred_offset& res, const float fx, float& fw) { res.p += (&fw)[res.offset] * fx; }
+// Applies updates[k] * x to factor k of every feature in one sweep.
+template <class T>
+void factor_update(T& weights, const VW::features& fs, uint64_t offset, uint32_t rank, const float* updates,
+    float regularization)
+{
+  for (size_t i = 0; i < fs.size(); i++)
+  {
+    const float x = fs.values[i];
+    float* w = &weights[fs.indices[i]] + offset;
+    for (uint32_t k = 0; k < rank; k++) { w[k] += updates[k] * x - regularization * w[k]; }
+  }
+}
 
 template <class T>
 float mf_predict(gdmf& d, VW::example& ec, T& weights)
@@ -139,25 +164,17 @@ float mf_predict(gdmf& d, VW::example& ec, T& weights)
 
     if (ec.feature_space[static_cast<int>(i[0])].size() > 0 && ec.feature_space[static_cast<int>(i[1])].size() > 0)
     {
-      for (uint64_t k = 1; k <= d.rank; k++)
+      // x_l * l^k and x_r * r^k, l^k is from index+1 to index+d.rank and r^k from index+d.rank+1 to index+2*d.rank
+      factor_dots(weights, ec.feature_space[static_cast<int>(i[0])], 1, d.rank, d.left_dots.data());
+      factor_dots(weights, ec.feature_space[static_cast<int>(i[1])], d.rank + 1, d.rank, d.right_dots.data());
+
+      for (uint32_t k = 0; k < d.rank; k++)
       {
-        // x_l * l^k
-        // l^k is from index+1 to index+d.rank
-        // float x_dot_l = sd_offset_add(weights, ec.atomics[(int)(*i)[0]].begin(), ec.atomics[(int)(*i)[0]].end(), k);
-        pred_offset x_dot_l = {0., k};
-        VW::foreach_feature<pred_offset, offset_add, T>(weights, ec.feature_space[static_cast<int>(i[0])], x_dot_l);
-        // x_r * r^k
-        // r^k is from index+d.rank+1 to index+2*d.rank
-        // float x_dot_r = sd_offset_add(weights, ec.atomics[(int)(*i)[1]].begin(), ec.atomics[(int)(*i)[1]].end(),
-        // k+d.rank);
-        pred_offset x_dot_r = {0., k + d.rank};
-        VW::foreach_feature<pred_offset, offset_add, T>(weights, ec.feature_space[static_cast<int>(i[1])], x_dot_r);
-
-        prediction += x_dot_l.p * x_dot_r.p;
+        prediction += d.left_dots[k] * d.right_dots[k];
 
         // store prediction from interaction terms
-        d.scalars.push_back(x_dot_l.p);
-        d.scalars.push_back(x_dot_r.p);
+        d.scalars.push_back(d.left_dots[k]);
+        d.scalars.push_back(d.right_dots[k]);
       }
     }
   }
@@ -220,23 +237,15 @@ void mf_train(gdmf& d, VW::example& ec, T& weights)
 
     if (ec.feature_space[static_cast<int>(i[0])].size() > 0 && ec.feature_space[static_cast<int>(i[1])].size() > 0)
     {
-      // update l^k weights
-      for (size_t k = 1; k <= d.rank; k++)
-      {
-        // r^k \cdot x_r
-        float r_dot_x = d.scalars[2 * k];
-        // l^k <- l^k + update * (r^k \cdot x_r) * x_l
-        sd_offset_update<T>(weights, ec.feature_space[static_cast<int>(i[0])], k, update * r_dot_x, regularization);
-      }
-      // update r^k weights
-      for (size_t k = 1; k <= d.rank; k++)
-      {
-        // l^k \cdot x_l
-        float l_dot_x = d.scalars[2 * k - 1];
-        // r^k <- r^k + update * (l^k \cdot x_l) * x_r
-        sd_offset_update<T>(
-            weights, ec.feature_space[static_cast<int>(i[1])], k + d.rank, update * l_dot_x, regularization);
-      }
+      // l^k <- l^k + update * (r^k \cdot x_r) * x_l
+      for (size_t k = 1; k <= d.rank; k++) { d.factor_updates[k - 1] = update * d.scalars[2 * k]; }
+      factor_update(weights, ec.feature_space[static_cast<int>(i[0])], 1, d.rank, d.factor_updates.data(),
+          regularization);
+
+      // r^k <- r^k + update * (l^k \cdot x_l) * x_r
+      for (size_t k = 1; k <= d.rank; k++) { d.factor_updates[k - 1] = update * d.scalars[2 * k - 1]; }
+      factor_update(weights, ec.feature_space[static_cast<int>(i[1])], d.rank + 1, d.rank, d.factor_updates.data(),
+          regularization);
     }
   }
 }
@@ -263,6 +272,13 @@ void save_load(gdmf& d, VW::io_buf& model_file, bool read, bool text)
   if (read)
   {
     VW::details::initialize_regressor(all);
+    // Sized once the weights exist, a corrupted rank is then reported by the check below rather than by the allocator.
+    if (all.weights.not_null())
+    {
+      d.left_dots.resize(d.rank);
+      d.right_dots.resize(d.rank);
+      d.factor_updates.resize(d.rank);
+    }
     if (all.initial_weights_config.random_weights)
     {
       uint32_t stride = all.weights.stride();
@@ -17,18 +17,21 @@
 #include "vw/core/numeric_casts.h"
 #include "vw/core/reductions/gd.h"
 #include "vw/core/setup_base.h"
+#include "vw/core/thread_pool.h"
 #include "vw/core/version.h"
 #include "vw/core/vw.h"
 #include "vw/core/vw_allreduce.h"
 #include "vw/core/vw_versions.h"
 #include "vw/io/logger.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cfloat>
 #include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <future>
 #include <map>
 #include <memory>
 #include <sstream>
@@ -123,6 +126,8 @@ class svm_example
 public:
   VW::v_array<float> krow;
   flat_example ex;
+  size_t last_used;  // value of svm_params::access_clock when krow was last needed
+  bool is_support;   // set once the example is in the model, its krow then counts towards svm_params::cached_kernels
 
   ~svm_example();
   void init_svm_example(flat_example* fec);
@@ -176,8 +181,14 @@ public:
   uint64_t reprocess = 0;
 
   svm_model* model = nullptr;
-  size_t maxcache = 0;
-  // size_t curcache;
+  size_t maxcache = 0;        // maximum number of cached kernel values
+  size_t cached_kernels = 0;  // kernel values currently cached in the rows of support vectors
+  size_t access_clock = 0;
+  std::vector<svm_example*> eviction_candidates;
+
+  // --ksvm_threads: new kernel values of a row are computed in chunks on the pool.
+  size_t num_threads = 1;
+  std::unique_ptr<VW::thread_pool> thread_pool;
 
   svm_example** pool = nullptr;
   float lambda = 0.f;
@@ -218,25 +229,74 @@ svm_example::~svm_example()
 
 float kernel_function(const flat_example* fec1, const flat_example* fec2, void* params, size_t kernel_type);
 
+// Clears the least recently used kernel rows of support vectors until needed more values fit in the cache. The row
+// of keep is never cleared. Rows are recomputed on demand, so eviction does not change any result.
+int evict_kernel_rows(svm_params& params, size_t needed, const svm_example* keep)
+{
+  if (params.cached_kernels + needed <= params.maxcache) { return 0; }
+
+  svm_model* model = params.model;
+  auto& candidates = params.eviction_candidates;
+  candidates.clear();
+  for (size_t i = 0; i < model->num_support; i++)
+  {
+    svm_example* e = model->support_vec[i];
+    if (e != keep && !e->krow.empty()) { candidates.push_back(e); }
+  }
+  std::sort(candidates.begin(), candidates.end(),
+      [](const svm_example* a, const svm_example* b) { return a->last_used < b->last_used; });
+
+  int alloc = 0;
+  for (svm_example* e : candidates)
+  {
+    if (params.cached_kernels + needed <= params.maxcache) { break; }
+    params.cached_kernels -= e->krow.size();
+    alloc += e->clear_kernels();
+  }
+  return alloc;
+}
+
+// Minimum number of new kernel values in a row before they are computed on the pool.
+constexpr size_t MIN_PARALLEL_KERNELS = 256;
+
 int svm_example::compute_kernels(svm_params& params)
 {
   int alloc = 0;
   svm_model* model = params.model;
   size_t n = model->num_support;
+  last_used = ++params.access_clock;
 
   if (krow.size() < n)
   {
     // computing new kernel values and caching them
-    // if(params->curcache + n > params->maxcache)
-    // trim_cache(params);
+    alloc += evict_kernel_rows(params, n - krow.size(), this);
     num_kernel_evals += krow.size();
-    for (size_t i = krow.size(); i < n; i++)
+    const size_t first = krow.size();
+    krow.resize(n);
+    auto compute_range = [this, &params, model](size_t begin, size_t end)
     {
-      svm_example* sec = model->support_vec[i];
-      float kv = kernel_function(&ex, &(sec->ex), params.kernel_params, params.kernel_type);
-      krow.push_back(kv);
-      alloc += 1;
+      for (size_t i = begin; i < end; i++)
+      {
+        krow[i] = kernel_function(&ex, &(model->support_vec[i]->ex), params.kernel_params, params.kernel_type);
+      }
+    };
+
+    const size_t count = n - first;
+    if (params.thread_pool == nullptr || count < MIN_PARALLEL_KERNELS) { compute_range(first, n); }
+    else
+    {
+      std::vector<std::future<void>> futures;
+      futures.reserve(params.num_threads);
+      for (size_t t = 0; t < params.num_threads; t++)
+      {
+        const size_t begin = first + count * t / params.num_threads;
+        const size_t end = first + count * (t + 1) / params.num_threads;
+        futures.push_back(params.thread_pool->submit([&compute_range, begin, end]() { compute_range(begin, end); }));
+      }
+      for (auto& f : futures) { f.get(); }
     }
+    alloc += static_cast<int>(count);
+    if (is_support) { params.cached_kernels += count; }
   }
   else { num_cache_evals += n; }
   return alloc;
@@ -245,10 +305,16 @@ int svm_example::compute_kernels(svm_params& params)
 int svm_example::clear_kernels()
 {
   int rowsize = static_cast<int>(krow.size());
-  krow.clear();
+  // Release the memory as well, evicted rows are usually not needed again soon.
+  krow.clear_noshrink();
+  krow.shrink_to_fit();
   return -rowsize;
 }
 
+// Moving a support vector to the front rotates every kernel row, make_hot_sv() is skipped when that is larger than
+// this. It does not follow --ksvm_cache_mb: the order of the support vectors changes the results, eviction does not.
+constexpr size_t MAX_HOT_SV_ROTATION = 1024 * 1024 * 1024;
+
 static int make_hot_sv(svm_params& params, size_t svi)
 {
   svm_model* model = params.model;
@@ -284,6 +350,7 @@ static int make_hot_sv(svm_params& params, size_t svi)
       float kv = svi_e->krow[j];
       e->krow.push_back(0);
       alloc += 1;
+      params.cached_kernels += 1;
       for (size_t i = e->krow.size() - 1; i > 0; --i) { e->krow[i] = e->krow[i - 1]; }
       e->krow[0] = kv;
     }
@@ -291,20 +358,7 @@ static int make_hot_sv(svm_params& params, size_t svi)
   return alloc;
 }
 
-static int trim_cache(svm_params& params)
-{
-  int sz = static_cast<int>(params.maxcache);
-  svm_model* model = params.model;
-  size_t n = model->num_support;
-  int alloc = 0;
-  for (size_t i = 0; i < n; i++)
-  {
-    svm_example* e = model->support_vec[i];
-    sz -= static_cast<int>(e->krow.size());
-    if (sz < 0) { alloc += e->clear_kernels(); }
-  }
-  return alloc;
-}
+static int trim_cache(svm_params& params) { return evict_kernel_rows(params, 0, nullptr); }
 
 void save_load_svm_model(svm_params& params, VW::io_buf& model_file, bool read, bool text)
 {
@@ -326,6 +380,7 @@ void save_load_svm_model(svm_params& params, VW::io_buf& model_file, bool read,
       auto* tmp = &VW::details::calloc_or_throw<svm_example>();
       read_model_field_flat_example(model_file, *fec, params.all->parser_runtime.example_parser->lbl_parser);
       tmp->ex = *fec;
+      tmp->is_support = true;
       model->support_vec.push_back(tmp);
     }
     else
@@ -452,6 +507,7 @@ int remove(svm_params& params, size_t svi)
   if (svi >= model->num_support) { params.all->logger.err_error("Internal error at {}:{}", __FILE__, __LINE__); }
   // shift params fields
   svm_example* svi_e = model->support_vec[svi];
+  params.cached_kernels -= svi_e->krow.size();
   for (size_t i = svi; i < model->num_support - 1; ++i)
   {
     model->support_vec[i] = model->support_vec[i + 1];
@@ -475,6 +531,7 @@ int remove(svm_params& params, size_t svi)
       for (size_t i = svi; i < rowsize - 1; i++) { e->krow[i] = e->krow[i + 1]; }
       e->krow.pop_back();
       alloc -= 1;
+      params.cached_kernels -= 1;
     }
   }
   return alloc;
@@ -484,6 +541,8 @@ int add(svm_params& params, svm_example* fec)
 {
   svm_model* model = params.model;
   model->num_support++;
+  fec->is_support = true;
+  params.cached_kernels += fec->krow.size();
   model->support_vec.push_back(fec);
   model->alpha.push_back(0.);
   model->delta.push_back(0.);
@@ -690,7 +749,7 @@ void train(svm_params& params)
               {
                 *params.all->output_runtime.trace_message << "Shouldn't reprocess right after process." << endl;
               }
-              if (max_pos * model->num_support <= params.maxcache) { make_hot_sv(params, max_pos); }
+              if (max_pos * model->num_support <= MAX_HOT_SV_ROTATION) { make_hot_sv(params, max_pos); }
               update(params, max_pos);
             }
           }
@@ -773,6 +832,8 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::kernel_svm_setup(VW::setup
   uint64_t subsample;
 
   bool ksvm = false;
+  uint64_t cache_mb;
+  uint64_t num_threads;
 
   option_group_definition new_options("[Reduction] Kernel SVM");
   new_options.add(make_option("ksvm", ksvm).keep().necessary().help("Kernel svm"))
@@ -787,7 +848,15 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::kernel_svm_setup(VW::setup
                .one_of({"linear", "rbf", "poly"})
                .help("Type of kernel"))
       .add(make_option("bandwidth", bandwidth).keep().default_value(1.f).help("Bandwidth of rbf kernel"))
-      .add(make_option("degree", degree).keep().default_value(2).help("Degree of poly kernel"));
+      .add(make_option("degree", degree).keep().default_value(2).help("Degree of poly kernel"))
+      .add(make_option("ksvm_cache_mb", cache_mb)
+               .default_value(4096)
+               .experimental()
+               .help("Memory for cached kernel rows in MB, the least recently used rows are evicted beyond it"))
+      .add(make_option("ksvm_threads", num_threads)
+               .default_value(1)
+               .experimental()
+               .help("Number of threads used to compute kernel rows. Results do not depend on it"));
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
 
@@ -802,7 +871,13 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::kernel_svm_setup(VW::setup
   params->model = &VW::details::calloc_or_throw<svm_model>();
   new (params->model) svm_model();
   params->model->num_support = 0;
-  params->maxcache = 1024 * 1024 * 1024;
+  params->maxcache = VW::cast_to_smaller_type<size_t>(cache_mb * 1024 * 1024 / sizeof(float));
+  if (num_threads == 0) { THROW("--ksvm_threads must be at least 1"); }
+  if (num_threads > 1)
+  {
+    params->num_threads = VW::cast_to_smaller_type<size_t>(num_threads);
+    params->thread_pool = VW::make_unique<VW::thread_pool>(params->num_threads);
+  }
   params->loss_sum = 0.;
   params->all = &all;
   params->random_state = all.get_random_state();
@@ -28,12 +28,15 @@ VW_WARNING_STATE_POP
 #include "vw/core/reductions/gd.h"
 #include "vw/core/reductions/mwt.h"
 #include "vw/core/shared_data.h"
+#include "vw/core/thread_pool.h"
 #include "vw/core/vw.h"
 #include "vw/core/vw_versions.h"
 #include "vw/io/logger.h"
 
 #if defined(__ARM_NEON)
 #  include <sse2neon/sse2neon.h>
+#elif defined(__AVX2__)
+#  include <immintrin.h>
 #endif
 
 #include <algorithm>
@@ -42,6 +45,7 @@ VW_WARNING_STATE_POP
 #include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <future>
 #include <numeric>
 #include <queue>
 #include <vector>
@@ -66,6 +70,16 @@ public:
   bool operator<(const index_feature b) const { return f.weight_index < b.f.weight_index; }
 };
 
+// Per thread buffers for the variational inference of one document.
+class lda_scratch
+{
+public:
+  VW::v_array<float> new_gamma;
+  VW::v_array<float> old_gamma;
+  VW::v_array<float> Elogtheta;  // NOLINT
+  VW::v_array<float> total_new;
+};
+
 class lda
 {
 public:
@@ -77,9 +91,7 @@ public:
   size_t minibatch = 0;
   lda_math_mode mmode;
 
-  VW::v_array<float> Elogtheta;  // NOLINT
   VW::v_array<float> decay_levels;
-  VW::v_array<float> total_new;
   VW::v_array<float> total_lambda;
   VW::v_array<int> doc_lengths;
   VW::v_array<float> digammas;
@@ -98,6 +110,13 @@ public:
 
   bool total_lambda_init = false;
 
+  // --lda_threads: the documents of a minibatch are split across the pool, and so are the rows of the words they
+  // contain. Each shard has its own scratch buffers and topic totals, which are reduced in shard order.
+  size_t num_threads = 1;
+  std::unique_ptr<VW::thread_pool> thread_pool;
+  std::vector<lda_scratch> scratch;
+  std::vector<float> scores;
+
   double example_t;
   VW::workspace* all = nullptr;  // regressor, lda
 
@@ -305,6 +324,140 @@ inline v4sf vfastdigamma(v4sf x)
       logterm;
 }
 
+// 256-bit versions of the approximations above. They compute the same per-element expressions; simd256 provides the
+// comparisons, conversions and loads for the width. The wide loops run first and leave the remainder to the 128-bit
+// and scalar loops. They cover exactly the elements the 128-bit loop would and add to its 128-bit running sum in the
+// same order, so the results are bit-identical to the 128-bit code. Wide loads are unaligned, which costs next to
+// nothing on CPUs with AVX.
+#    if defined(__AVX2__)
+#      ifdef _WIN32
+
+inline __m256 operator+(const __m256 a, const __m256 b) { return _mm256_add_ps(a, b); }
+
+inline __m256 operator-(const __m256 a, const __m256 b) { return _mm256_sub_ps(a, b); }
+
+inline __m256 operator*(const __m256 a, const __m256 b) { return _mm256_mul_ps(a, b); }
+
+inline __m256 operator/(const __m256 a, const __m256 b) { return _mm256_div_ps(a, b); }
+
+#      endif
+
+class simd256
+{
+public:
+  using vf = __m256;
+  using vi = __m256i;
+  static constexpr size_t WIDTH = 8;
+
+  static __m256 set1(const float x) { return _mm256_set1_ps(x); }
+  static vi set1i(const uint32_t x) { return _mm256_set1_epi32(static_cast<int>(x)); }
+  // Lanes where a < b take if_true, the others if_false.
+  static __m256 select_lt(const __m256 a, const __m256 b, const __m256 if_true, const __m256 if_false)
+  {
+    return _mm256_blendv_ps(if_false, if_true, _mm256_cmp_ps(a, b, _CMP_LT_OQ));
+  }
+  static vi to_int(const __m256 x) { return _mm256_cvttps_epi32(x); }
+  static __m256 to_float(const vi x) { return _mm256_cvtepi32_ps(x); }
+  static __m256 bits_to_float(const vi x) { return _mm256_castsi256_ps(x); }
+  static vi float_to_bits(const __m256 x) { return _mm256_castps_si256(x); }
+  static vi and_or(const vi x, const vi and_mask, const vi or_mask)
+  {
+    return _mm256_or_si256(_mm256_and_si256(x, and_mask), or_mask);
+  }
+  static __m256 max(const __m256 a, const __m256 b) { return _mm256_max_ps(a, b); }
+  static __m256 load(const float* p) { return _mm256_loadu_ps(p); }
+  static void store(float* p, const __m256 x) { _mm256_storeu_ps(p, x); }
+  // Adds the 128-bit halves of x to sum one after the other, like two iterations of the 128-bit loop.
+  static __m128 add_halves(__m128 sum, const __m256 x)
+  {
+    sum = _mm_add_ps(sum, _mm256_castps256_ps128(x));
+    return _mm_add_ps(sum, _mm256_extractf128_ps(x, 1));
+  }
+};
+
+template <typename traits, typename V = typename traits::vf>
+inline V vfastpow2(const V p)
+{
+  V offset = traits::select_lt(p, traits::set1(0.0f), traits::set1(1.0f), traits::set1(0.0f));
+  V clipp = traits::select_lt(p, traits::set1(-126.0f), traits::set1(-126.0f), p);
+  V z = clipp - traits::to_float(traits::to_int(clipp)) + offset;
+
+  V v = traits::set1(1 << 23) *
+      (clipp + traits::set1(121.2740838f) + traits::set1(27.7280233f) / (traits::set1(4.84252568f) - z) -
+          traits::set1(1.49012907f) * z);
+
+  return traits::bits_to_float(traits::to_int(v));
+}
+
+template <typename traits, typename V = typename traits::vf>
+inline V vfastexp(const V p)
+{
+  return vfastpow2<traits>(traits::set1(1.442695040f) * p);
+}
+
+template <typename traits, typename V = typename traits::vf>
+inline V vfastlog(const V x)
+{
+  typename traits::vi vx_i = traits::float_to_bits(x);
+  V mx_f = traits::bits_to_float(traits::and_or(vx_i, traits::set1i(0x007FFFFF), traits::set1i(0x3f000000)));
+  V y = traits::to_float(vx_i) * traits::set1(1.1920928955078125e-7f);
+
+  V log2 = y - traits::set1(124.22551499f) - traits::set1(1.498030302f) * mx_f -
+      traits::set1(1.72587999f) / (traits::set1(0.3520887068f) + mx_f);
+  return traits::set1(0.69314718f) * log2;
+}
+
+template <typename traits, typename V = typename traits::vf>
+inline V vfastdigamma(const V x)
+{
+  V twopx = traits::set1(2.0f) + x;
+  V logterm = vfastlog<traits>(twopx);
+
+  return (traits::set1(-48.0f) + x * (traits::set1(-157.0f) + x * (traits::set1(-127.0f) - traits::set1(30.0f) * x))) /
+      (traits::set1(12.0f) * x * (traits::set1(1.0f) + x) * twopx * twopx) +
+      logterm;
+}
+
+// Replaces gamma by digamma(gamma) and adds the original values to the 128-bit sum, for as many whole vectors as the
+// 128-bit loop would process.
+template <typename traits, typename V = typename traits::vf>
+inline float* wide_digammify(float* fp, const float* fpend, v4sf& sum)
+{
+  for (; fp + traits::WIDTH < fpend; fp += traits::WIDTH)
+  {
+    V arg = traits::load(fp);
+    sum = traits::add_halves(sum, arg);
+    traits::store(fp, vfastdigamma<traits>(arg));
+  }
+  return fp;
+}
+
+// Replaces gamma by max(threshold, exp(gamma - norm)), for as many whole vectors as the 128-bit loop would process.
+template <typename traits, typename V = typename traits::vf>
+inline float* wide_expify(float* fp, const float* fpend, const float norm, const float underflow_threshold)
+{
+  for (; fp + traits::WIDTH < fpend; fp += traits::WIDTH)
+  {
+    V arg = traits::load(fp) - traits::set1(norm);
+    traits::store(fp, traits::max(traits::set1(underflow_threshold), vfastexp<traits>(arg)));
+  }
+  return fp;
+}
+
+// Replaces gamma by max(threshold, exp(digamma(gamma) - norm)), for as many whole vectors as the 128-bit loop would
+// process.
+template <typename traits, typename V = typename traits::vf>
+inline float* wide_expdigammify_2(float* fp, const float* fpend, const float*& np, const float underflow_threshold)
+{
+  for (; fp + traits::WIDTH < fpend; fp += traits::WIDTH, np += traits::WIDTH)
+  {
+    V arg = vfastdigamma<traits>(traits::load(fp)) - traits::load(np);
+    traits::store(fp, traits::max(traits::set1(underflow_threshold), vfastexp<traits>(arg)));
+  }
+  return fp;
+}
+#    endif
+
 void vexpdigammify(VW::workspace& all, float* gamma, const float underflow_threshold)
 {
   float extra_sum = 0.0f;
@@ -320,6 +473,10 @@ void vexpdigammify(VW::workspace& all, float* gamma, const float underflow_thres
     *fp = fastdigamma(*fp);
   }
 
+#    if defined(__AVX2__)
+  fp = wide_digammify<simd256>(fp, fpend, sum);
+#    endif
+
   // Rip through the aligned portion...
   for (; is_aligned16(fp) && fp + 4 < fpend; fp += 4)
   {
@@ -352,6 +509,10 @@ void vexpdigammify(VW::workspace& all, float* gamma, const float underflow_thres
     *fp = std::fmax(underflow_threshold, fastexp(*fp - extra_sum));
   }
 
+#    if defined(__AVX2__)
+  fp = wide_expify<simd256>(fp, fpend, extra_sum, underflow_threshold);
+#    endif
+
   for (; is_aligned16(fp) && fp + 4 < fpend; fp += 4)
   {
     v4sf arg = _mm_load_ps(fp);
@@ -375,6 +536,10 @@ void vexpdigammify_2(VW::workspace& all, float* gamma, const float* norm, const
     *fp = std::fmax(underflow_threshold, fastexp(fastdigamma(*fp) - *np));
   }
 
+#    if defined(__AVX2__)
+  fp = wide_expdigammify_2<simd256>(fp, fpend, np, underflow_threshold);
+#    endif
+
   for (; is_aligned16(fp) && fp + 4 < fpend; fp += 4, np += 4)
   {
     v4sf arg = _mm_load_ps(fp);
@@ -679,21 +844,16 @@ static inline float find_cw(lda& l, float* u_for_w, float* v)
   return 1.0f / std::inner_product(u_for_w, u_for_w + l.topics, v, 0.0f);
 }
 
-namespace
-{
-// Effectively, these are static and not visible outside the compilation unit.
-VW::v_array<float> new_gamma;
-VW::v_array<float> old_gamma;
-}  // namespace
-
 // Returns an estimate of the part of the variational bound that
 // doesn't have to do with beta for the entire corpus for the current
 // setting of lambda based on the document passed in. The value is
 // divided by the total number of words in the document This can be
 // used as a (possibly very noisy) estimate of held-out likelihood.
-float lda_loop(lda& l, VW::v_array<float>& Elogtheta, float* v, VW::example* ec, float)
+float lda_loop(lda& l, lda_scratch& scratch, float* v, VW::example* ec)
 {
   parameters& weights = l.all->weights;
+  VW::v_array<float>& new_gamma = scratch.new_gamma;
+  VW::v_array<float>& old_gamma = scratch.old_gamma;
   new_gamma.clear();
   old_gamma.clear();
 
@@ -735,7 +895,7 @@ float lda_loop(lda& l, VW::v_array<float>& Elogtheta, float* v, VW::example* ec,
   ec->pred.scalars.resize(l.topics);
   memcpy(ec->pred.scalars.begin(), new_gamma.begin(), l.topics * sizeof(float));
 
-  score += theta_kl(l, Elogtheta, new_gamma.begin());
+  score += theta_kl(l, scratch.Elogtheta, new_gamma.begin());
 
   return score / doc_length;
 }
@@ -835,6 +995,35 @@ void save_load(lda& l, VW::io_buf& model_file, bool read, bool text)
   }
 }
 
+// Runs work(shard) for every shard of the minibatch, on the pool when there is one.
+template <class WorkT>
+void for_each_shard(lda& l, WorkT&& work)
+{
+  if (l.thread_pool == nullptr)
+  {
+    work(0);
+    return;
+  }
+
+  std::vector<std::future<void>> futures;
+  futures.reserve(l.scratch.size());
+  for (size_t shard = 0; shard < l.scratch.size(); ++shard)
+  {
+    futures.push_back(l.thread_pool->submit([&work, shard]() { work(shard); }));
+  }
+  for (auto& f : futures) { f.get(); }
+}
+
+// Weight rows are split into contiguous ranges, one per shard. Features are owned by the row they land on after
+// masking, so hash collisions between different weight indices are handled by a single thread, in sorted order.
+size_t row_shard(const lda& l, uint64_t weight_index)
+{
+  if (l.scratch.size() == 1) { return 0; }
+  const parameters& weights = l.all->weights;
+  const uint64_t row = (weight_index & weights.mask()) >> weights.stride_shift();
+  return static_cast<size_t>((row * l.scratch.size()) >> l.all->initial_weights_config.num_bits);
+}
+
 void learn_batch(lda& l, std::vector<example*>& batch)
 {
   parameters& weights = l.all->weights;
@@ -865,8 +1054,11 @@ void learn_batch(lda& l, std::vector<example*>& batch)
   }
 
   l.example_t++;
-  l.total_new.clear();
-  for (size_t k = 0; k < l.all->reduction_state.lda; k++) { l.total_new.push_back(0.f); }
+  for (auto& scratch : l.scratch)
+  {
+    scratch.total_new.clear();
+    for (size_t k = 0; k < l.all->reduction_state.lda; k++) { scratch.total_new.push_back(0.f); }
+  }
 
   size_t batch_size = batch.size();
 
@@ -884,75 +1076,100 @@ void learn_batch(lda& l, std::vector<example*>& batch)
     l.digammas.push_back(l.digamma(l.total_lambda[i] + additional));
   }
 
-  auto last_weight_index = std::numeric_limits<uint64_t>::max();
-  for (index_feature* s = &l.sorted_features[0]; s <= &l.sorted_features.back(); s++)
-  {
-    if (last_weight_index == s->f.weight_index) { continue; }
-    last_weight_index = s->f.weight_index;
-    // float *weights_for_w = &(weights[s->f.weight_index]);
-    float* weights_for_w = &(weights[s->f.weight_index & weights.mask()]);
-    float decay_component = l.decay_levels.end()[-2] -
-        l.decay_levels.end()[static_cast<int>(-1 - l.example_t + *(weights_for_w + l.all->reduction_state.lda))];
-    float decay = std::fmin(1.0f, VW::details::correctedExp(decay_component));
-    float* u_for_w = weights_for_w + l.all->reduction_state.lda + 1;
-
-    *(weights_for_w + l.all->reduction_state.lda) = static_cast<float>(l.example_t);
-    for (size_t k = 0; k < l.all->reduction_state.lda; k++)
-    {
-      weights_for_w[k] *= decay;
-      u_for_w[k] = weights_for_w[k] + l.lda_rho;
-    }
+  for_each_shard(l,
+      [&](size_t shard)
+      {
+        auto last_weight_index = std::numeric_limits<uint64_t>::max();
+        for (index_feature* s = &l.sorted_features[0]; s <= &l.sorted_features.back(); s++)
+        {
+          if (last_weight_index == s->f.weight_index) { continue; }
+          last_weight_index = s->f.weight_index;
+          if (row_shard(l, s->f.weight_index) != shard) { continue; }
+          // float *weights_for_w = &(weights[s->f.weight_index]);
+          float* weights_for_w = &(weights[s->f.weight_index & weights.mask()]);
+          float decay_component = l.decay_levels.end()[-2] -
+              l.decay_levels.end()[static_cast<int>(-1 - l.example_t + *(weights_for_w + l.all->reduction_state.lda))];
+          float decay = std::fmin(1.0f, VW::details::correctedExp(decay_component));
+          float* u_for_w = weights_for_w + l.all->reduction_state.lda + 1;
+
+          *(weights_for_w + l.all->reduction_state.lda) = static_cast<float>(l.example_t);
+          for (size_t k = 0; k < l.all->reduction_state.lda; k++)
+          {
+            weights_for_w[k] *= decay;
+            u_for_w[k] = weights_for_w[k] + l.lda_rho;
+          }
+
+          l.expdigammify_2(*l.all, u_for_w, l.digammas.begin());
+        }
+      });
 
-    l.expdigammify_2(*l.all, u_for_w, l.digammas.begin());
-  }
+  // The weights are only read while documents are processed, so any split of the batch gives the same scores.
+  l.scores.resize(batch_size);
+  for_each_shard(l,
+      [&](size_t shard)
+      {
+        const size_t last = batch_size * (shard + 1) / l.scratch.size();
+        for (size_t d = batch_size * shard / l.scratch.size(); d < last; d++)
+        {
+          l.scores[d] = lda_loop(l, l.scratch[shard], &(l.v[d * l.all->reduction_state.lda]), batch[d]);
+        }
+      });
 
   for (size_t d = 0; d < batch_size; d++)
   {
-    float score =
-        lda_loop(l, l.Elogtheta, &(l.v[d * l.all->reduction_state.lda]), batch[d], l.all->update_rule_config.power_t);
     if (l.all->output_config.audit) { VW::details::print_audit_features(*l.all, *batch[d]); }
     // If the doc is empty, give it loss of 0.
     if (l.doc_lengths[d] > 0)
     {
-      l.all->sd->sum_loss -= score;
-      l.all->sd->sum_loss_since_last_dump -= score;
+      l.all->sd->sum_loss -= l.scores[d];
+      l.all->sd->sum_loss_since_last_dump -= l.scores[d];
     }
   }
 
   // -t there's no need to update weights (especially since it's a noop)
   if (eta != 0)
   {
-    for (index_feature* s = &l.sorted_features[0]; s <= &l.sorted_features.back();)
-    {
-      index_feature* next = s + 1;
-      while (next <= &l.sorted_features.back() && next->f.weight_index == s->f.weight_index) { next++; }
-
-      float* word_weights = &(weights[s->f.weight_index]);
-      for (size_t k = 0; k < l.all->reduction_state.lda; k++, ++word_weights)
-      {
-        float new_value = minuseta * *word_weights;
-        *word_weights = new_value;
-      }
-
-      for (; s != next; s++)
-      {
-        float* v_s = &(l.v[static_cast<size_t>(s->document) * static_cast<size_t>(l.all->reduction_state.lda)]);
-        float* u_for_w = &(weights[s->f.weight_index]) + l.all->reduction_state.lda + 1;
-        float c_w = eta * find_cw(l, u_for_w, v_s) * s->f.x;
-        word_weights = &(weights[s->f.weight_index]);
-        for (size_t k = 0; k < l.all->reduction_state.lda; k++, ++u_for_w, ++word_weights)
+    for_each_shard(l,
+        [&](size_t shard)
         {
-          float new_value = *u_for_w * v_s[k] * c_w;
-          l.total_new[k] += new_value;
-          *word_weights += new_value;
-        }
-      }
-    }
+          VW::v_array<float>& total_new = l.scratch[shard].total_new;
+          for (index_feature* s = &l.sorted_features[0]; s <= &l.sorted_features.back();)
+          {
+            index_feature* next = s + 1;
+            while (next <= &l.sorted_features.back() && next->f.weight_index == s->f.weight_index) { next++; }
+            if (row_shard(l, s->f.weight_index) != shard)
+            {
+              s = next;
+              continue;
+            }
+
+            float* word_weights = &(weights[s->f.weight_index]);
+            for (size_t k = 0; k < l.all->reduction_state.lda; k++, ++word_weights)
+            {
+              float new_value = minuseta * *word_weights;
+              *word_weights = new_value;
+            }
+
+            for (; s != next; s++)
+            {
+              float* v_s = &(l.v[static_cast<size_t>(s->document) * static_cast<size_t>(l.all->reduction_state.lda)]);
+              float* u_for_w = &(weights[s->f.weight_index]) + l.all->reduction_state.lda + 1;
+              float c_w = eta * find_cw(l, u_for_w, v_s) * s->f.x;
+              word_weights = &(weights[s->f.weight_index]);
+              for (size_t k = 0; k < l.all->reduction_state.lda; k++, ++u_for_w, ++word_weights)
+              {
+                float new_value = *u_for_w * v_s[k] * c_w;
+                total_new[k] += new_value;
+                *word_weights += new_value;
+              }
+            }
+          }
+        });
 
     for (size_t k = 0; k < l.all->reduction_state.lda; k++)
     {
       l.total_lambda[k] *= minuseta;
-      l.total_lambda[k] += l.total_new[k];
+      for (const auto& scratch : l.scratch) { l.total_lambda[k] += scratch.total_new[k]; }
     }
   }
   l.sorted_features.resize(0);
@@ -1303,6 +1520,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::lda_setup(VW::setup_base_i
   int64_t math_mode;
   uint64_t topics;
   uint64_t minibatch;
+  uint64_t num_threads;
   new_options.add(make_option("lda", topics).keep().necessary().help("Run lda with <int> topics"))
       .add(make_option("lda_alpha", ld->lda_alpha)
                .keep()
@@ -1315,6 +1533,11 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::lda_setup(VW::setup_base_i
       .add(make_option("lda_D", ld->lda_D).default_value(10000.0f).help("Number of documents"))
       .add(make_option("lda_epsilon", ld->lda_epsilon).default_value(0.001f).help("Loop convergence threshold"))
       .add(make_option("minibatch", minibatch).default_value(1).help("Minibatch size, for LDA"))
+      .add(make_option("lda_threads", num_threads)
+               .default_value(1)
+               .experimental()
+               .help("Number of threads used for the documents of a minibatch and their words. Results are "
+                     "deterministic for a given number of threads"))
       .add(make_option("math-mode", math_mode)
                .default_value(static_cast<int64_t>(lda_math_mode::USE_SIMD))
                .one_of({0, 1, 2})
@@ -1370,6 +1593,21 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::lda_setup(VW::setup_base_i
 
   ld->v.resize(all.reduction_state.lda * ld->minibatch);
 
+  if (num_threads == 0) { THROW("--lda_threads must be at least 1"); }
+  if (num_threads > 1)
+  {
+    if (all.weights.sparse)
+    {
+      all.logger.err_warn("--lda_threads is ignored with --sparse_weights, LDA runs on a single thread.");
+    }
+    else
+    {
+      ld->num_threads = num_threads;
+      ld->thread_pool = VW::make_unique<VW::thread_pool>(num_threads);
+    }
+  }
+  ld->scratch.resize(ld->num_threads);
+
   ld->decay_levels.push_back(0.f);
 
   // If minibatch is > 1, then the predict function does not actually produce predictions.
@@ -89,6 +89,7 @@ void predict_or_learn(lrq_state& lrq, learner& base, VW::example& ec)
   float scale = (!lrq.dropout || do_dropout) ? 1.f : 0.5f;
 
   uint32_t stride_shift = lrq.all->weights.stride_shift();
+  const bool audit = all.output_config.audit || all.output_config.hash_inv;
   for (unsigned int iter = 0; iter < maxiter; ++iter, ++which)
   {
     // Add left LRQ features, holding right LRQ features fixed
@@ -103,6 +104,12 @@ void predict_or_learn(lrq_state& lrq, learner& base, VW::example& ec)
       unsigned int k = atoi(i.c_str() + 2);
 
       auto& left_fs = ec.feature_space[left];
+      auto& right_fs = ec.feature_space[right];
+      // Every left feature and rank dimension adds a copy of the right namespace, grow it once up front.
+      const size_t added = static_cast<size_t>(lrq.orig_size[left]) * k * lrq.orig_size[right];
+      right_fs.values.reserve(right_fs.size() + added);
+      right_fs.indices.reserve(right_fs.size() + added);
+      if (audit) { right_fs.space_names.reserve(right_fs.size() + added); }
       for (unsigned int lfn = 0; lfn < lrq.orig_size[left]; ++lfn)
       {
         float lfx = left_fs.values[lfn];
@@ -123,7 +130,7 @@ void predict_or_learn(lrq_state& lrq, learner& base, VW::example& ec)
               }
             }
 
-            auto& right_fs = ec.feature_space[right];
+            const float lw_lfx = scale * *lw * lfx;
             for (unsigned int rfn = 0; rfn < lrq.orig_size[right]; ++rfn)
             {
               // NB: ec.ft_offset added by base learner
@@ -131,9 +138,9 @@ void predict_or_learn(lrq_state& lrq, learner& base, VW::example& ec)
               uint64_t rindex = right_fs.indices[rfn];
               uint64_t rwindex = (rindex + (static_cast<uint64_t>(n) << stride_shift));
 
-              right_fs.push_back(scale * *lw * lfx * rfx, rwindex);
+              right_fs.push_back(lw_lfx * rfx, rwindex);
 
-              if (all.output_config.audit || all.output_config.hash_inv)
+              if (audit)
               {
                 std::stringstream new_feature_buffer;
                 new_feature_buffer << right << '^' << right_fs.space_names[rfn].name << '^' << n;
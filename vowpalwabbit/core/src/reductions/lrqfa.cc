@@ -63,6 +63,7 @@ void predict_or_learn(lrqfa_state& lrq, learner& base, VW::example& ec)
 
   uint32_t stride_shift = lrq.all->weights.stride_shift();
   uint64_t weight_mask = lrq.all->weights.mask();
+  const bool audit = all.output_config.audit || all.output_config.hash_inv;
   for (unsigned int iter = 0; iter < maxiter; ++iter, ++which)
   {
     // Add left LRQ features, holding right LRQ features fixed
@@ -76,9 +77,15 @@ void predict_or_learn(lrqfa_state& lrq, learner& base, VW::example& ec)
         unsigned char right = ((which + 1) % 2) ? *i1 : *i2;
         unsigned int lfd_id = lrq.field_id[left];
         unsigned int rfd_id = lrq.field_id[right];
+        auto& fs = ec.feature_space[left];
+        auto& rfs = ec.feature_space[right];
+        // Every left feature and rank dimension adds a copy of the right namespace, grow it once up front.
+        const size_t added = static_cast<size_t>(lrq.orig_size[left]) * k * lrq.orig_size[right];
+        rfs.values.reserve(rfs.size() + added);
+        rfs.indices.reserve(rfs.size() + added);
+        if (audit) { rfs.space_names.reserve(rfs.size() + added); }
         for (unsigned int lfn = 0; lfn < lrq.orig_size[left]; ++lfn)
         {
-          auto& fs = ec.feature_space[left];
           float lfx = fs.values[lfn];
           uint64_t lindex = fs.indices[lfn];
           for (unsigned int n = 1; n <= k; ++n)
@@ -92,17 +99,16 @@ void predict_or_learn(lrqfa_state& lrq, learner& base, VW::example& ec)
               if (!example_is_test(ec) && *lw == 0) { *lw = cheesyrand(lwindex) * 0.5f / sqrtk; }
             }
 
+            const float lw_lfx = *lw * lfx;
             for (unsigned int rfn = 0; rfn < lrq.orig_size[right]; ++rfn)
             {
-              auto& rfs = ec.feature_space[right];
-              //                    feature* rf = ec.atomics[right].begin + rfn;
               // NB: ec.ft_offset added by base learner
               float rfx = rfs.values[rfn];
               uint64_t rindex = rfs.indices[rfn];
               uint64_t rwindex = (rindex + (static_cast<uint64_t>(lfd_id * k + n) << stride_shift));
 
-              rfs.push_back(*lw * lfx * rfx, rwindex);
-              if (all.output_config.audit || all.output_config.hash_inv)
+              rfs.push_back(lw_lfx * rfx, rwindex);
+              if (audit)
               {
                 std::stringstream new_feature_buffer;
                 new_feature_buffer << right << '^' << rfs.space_names[rfn].name << '^' << n;
@@ -134,7 +140,7 @@ void predict_or_learn(lrqfa_state& lrq, learner& base, VW::example& ec)
       VW::namespace_index right = i;
       auto& rfs = ec.feature_space[right];
       rfs.values.resize(lrq.orig_size[right]);
-      if (all.output_config.audit || all.output_config.hash_inv) { rfs.space_names.resize(lrq.orig_size[right]); }
+      if (audit) { rfs.space_names.resize(lrq.orig_size[right]); }
     }
   }
 }
@@ -206,6 +206,13 @@ public:
 
   VW::example* kprod_ec = nullptr;
 
+  // Scratch space reused across examples
+  VW::features flat_query;                                // flattened features of the example being looked up
+  std::vector<std::unique_ptr<VW::features>> flat_memories;  // flattened features of examples, filled on first use
+  VW::v_array<uint32_t> leaf_labs;
+  VW::v_array<uint32_t> selected_labs;
+  VW::v_array<uint64_t> path;
+
   memory_tree()
   {
     alpha = 0.5f;
@@ -227,12 +234,24 @@ public:
   }
 };
 
-float normalized_linear_prod(memory_tree& b, VW::example* ec1, VW::example* ec2)
+// Stored examples never change once inserted, so they are flattened once.
+const VW::features& flat_memory(memory_tree& b, uint32_t loc)
 {
-  VW::features fs1;
-  VW::features fs2;
-  flatten_features(*b.all, *ec1, fs1);
-  flatten_features(*b.all, *ec2, fs2);
+  if (b.flat_memories.size() < b.examples.size()) { b.flat_memories.resize(b.examples.size()); }
+  auto& fs = b.flat_memories[loc];
+  if (fs == nullptr)
+  {
+    fs = VW::make_unique<VW::features>();
+    flatten_features(*b.all, *b.examples[loc], *fs);
+  }
+  return *fs;
+}
+
+// flat_query must hold the flattened features of the example being compared.
+float normalized_linear_prod(memory_tree& b, uint32_t loc)
+{
+  const VW::features& fs1 = b.flat_query;
+  const VW::features& fs2 = flat_memory(b, loc);
   float norm_sqrt = std::pow(fs1.sum_feat_sq * fs2.sum_feat_sq, 0.5f);
   float linear_prod = VW::features_dot_product(fs1, fs2);
   return linear_prod / norm_sqrt;
@@ -354,8 +373,8 @@ float train_node(memory_tree& b, learner& base, VW::example& ec, const uint64_t
   }
   else
   {
-    multilabels = ec.l.multilabels;
-    preds = ec.pred.multilabels;
+    multilabels = std::move(ec.l.multilabels);
+    preds = std::move(ec.pred.multilabels);
   }
 
   ec.l.simple = {1.f};
@@ -386,8 +405,8 @@ float train_node(memory_tree& b, learner& base, VW::example& ec, const uint64_t
   }
   else
   {
-    ec.pred.multilabels = preds;
-    ec.l.multilabels = multilabels;
+    ec.pred.multilabels = std::move(preds);
+    ec.l.multilabels = std::move(multilabels);
   }
 
   ec.weight = ec_input_weight;
@@ -440,8 +459,8 @@ void split_leaf(memory_tree& b, learner& base, const uint64_t cn)
     }
     else
     {
-      multilabels = b.examples[ec_pos]->l.multilabels;
-      preds = b.examples[ec_pos]->pred.multilabels;
+      multilabels = std::move(b.examples[ec_pos]->l.multilabels);
+      preds = std::move(b.examples[ec_pos]->pred.multilabels);
     }
 
     b.examples[ec_pos]->l.simple = {1.f};
@@ -469,8 +488,8 @@ void split_leaf(memory_tree& b, learner& base, const uint64_t cn)
     }
     else
     {
-      b.examples[ec_pos]->pred.multilabels = preds;
-      b.examples[ec_pos]->l.multilabels = multilabels;
+      b.examples[ec_pos]->pred.multilabels = std::move(preds);
+      b.examples[ec_pos]->l.multilabels = std::move(multilabels);
     }
   }
   b.nodes[cn].examples_index.clear();  // empty the cn's example list
@@ -536,7 +555,7 @@ void collect_labels_from_leaf(memory_tree& b, const uint64_t cn, VW::v_array<uin
 
 inline void train_one_against_some_at_leaf(memory_tree& b, learner& base, const uint64_t cn, VW::example& ec)
 {
-  VW::v_array<uint32_t> leaf_labs;
+  auto& leaf_labs = b.leaf_labs;
   collect_labels_from_leaf(b, cn, leaf_labs);  // unique labels from the leaf.
   auto& multilabels = ec.l.multilabels;
   auto& preds = ec.pred.multilabels;
@@ -559,7 +578,7 @@ inline uint32_t compute_hamming_loss_via_oas(
     memory_tree& b, learner& base, const uint64_t cn, VW::example& ec, VW::v_array<uint32_t>& selected_labs)
 {
   selected_labs.clear();
-  VW::v_array<uint32_t> leaf_labs;
+  auto& leaf_labs = b.leaf_labs;
   collect_labels_from_leaf(b, cn, leaf_labs);  // unique labels stored in the leaf.
   auto& multilabels = ec.l.multilabels;
   auto& preds = ec.pred.multilabels;
@@ -584,6 +603,7 @@ int64_t pick_nearest(memory_tree& b, learner& base, const uint64_t cn, VW::examp
   {
     float max_score = -FLT_MAX;
     int64_t max_pos = -1;
+    flatten_features(*b.all, ec, b.flat_query);
     for (size_t i = 0; i < b.nodes[cn].examples_index.size(); i++)
     {
       float score = 0.f;
@@ -593,7 +613,7 @@ int64_t pick_nearest(memory_tree& b, learner& base, const uint64_t cn, VW::examp
       //(which is for unsupervised training for memory tree)
       if (b.learn_at_leaf == true && b.current_pass >= 1)
       {
-        float tmp_s = normalized_linear_prod(b, &ec, b.examples[loc]);
+        float tmp_s = normalized_linear_prod(b, loc);
         diag_kronecker_product_test(ec, *b.examples[loc], *b.kprod_ec, b.oas);
         b.kprod_ec->l.simple = {FLT_MAX};
         auto& simple_red_features =
@@ -602,7 +622,7 @@ int64_t pick_nearest(memory_tree& b, learner& base, const uint64_t cn, VW::examp
         base.predict(*b.kprod_ec, b.max_routers);
         score = b.kprod_ec->partial_prediction;
       }
-      else { score = normalized_linear_prod(b, &ec, b.examples[loc]); }
+      else { score = normalized_linear_prod(b, loc); }
 
       if (score > max_score)
       {
@@ -647,8 +667,8 @@ void predict(memory_tree& b, learner& base, VW::example& ec)
   }
   else
   {
-    multilabels = ec.l.multilabels;
-    preds = ec.pred.multilabels;
+    multilabels = std::move(ec.l.multilabels);
+    preds = std::move(ec.pred.multilabels);
   }
 
   uint64_t cn = 0;
@@ -668,8 +688,8 @@ void predict(memory_tree& b, learner& base, VW::example& ec)
   }
   else
   {
-    ec.pred.multilabels = preds;
-    ec.l.multilabels = multilabels;
+    ec.pred.multilabels = std::move(preds);
+    ec.l.multilabels = std::move(multilabels);
   }
 
   int64_t closest_ec = 0;
@@ -694,8 +714,7 @@ void predict(memory_tree& b, learner& base, VW::example& ec)
       reward = f1_score_for_two_examples(ec, *b.examples[closest_ec]);
       b.f1_score += reward;
     }
-    VW::v_array<uint32_t> selected_labs;
-    ec.loss = static_cast<float>(compute_hamming_loss_via_oas(b, base, cn, ec, selected_labs));
+    ec.loss = static_cast<float>(compute_hamming_loss_via_oas(b, base, cn, ec, b.selected_labs));
     b.hamming_loss += ec.loss;
   }
 }
@@ -713,8 +732,8 @@ float return_reward_from_node(memory_tree& b, learner& base, uint64_t cn, VW::ex
   }
   else
   {
-    multilabels = ec.l.multilabels;
-    preds = ec.pred.multilabels;
+    multilabels = std::move(ec.l.multilabels);
+    preds = std::move(ec.pred.multilabels);
   }
   ec.l.simple = {FLT_MAX};
   ec.ex_reduction_features.template get<VW::simple_label_reduction_features>().reset_to_default();
@@ -732,8 +751,8 @@ float return_reward_from_node(memory_tree& b, learner& base, uint64_t cn, VW::ex
   }
   else
   {
-    ec.pred.multilabels = preds;
-    ec.l.multilabels = multilabels;
+    ec.pred.multilabels = std::move(preds);
+    ec.l.multilabels = std::move(multilabels);
   }
 
   // get to leaf now:
@@ -752,7 +771,8 @@ float return_reward_from_node(memory_tree& b, learner& base, uint64_t cn, VW::ex
 
   if (b.learn_at_leaf == true && closest_ec != -1)
   {
-    float score = normalized_linear_prod(b, &ec, b.examples[closest_ec]);
+    flatten_features(*b.all, ec, b.flat_query);
+    float score = normalized_linear_prod(b, static_cast<uint32_t>(closest_ec));
     diag_kronecker_product_test(ec, *b.examples[closest_ec], *b.kprod_ec, b.oas);
     b.kprod_ec->l.simple = {reward};
     auto& simple_red_features = b.kprod_ec->ex_reduction_features.template get<VW::simple_label_reduction_features>();
@@ -783,7 +803,8 @@ void learn_at_leaf_random(memory_tree& b, learner& base, const uint64_t& leaf_id
   if (ec_id != -1)
   {
     if (b.examples[ec_id]->l.multi.label == ec.l.multi.label) { reward = 1.f; }
-    float score = normalized_linear_prod(b, &ec, b.examples[ec_id]);
+    flatten_features(*b.all, ec, b.flat_query);
+    float score = normalized_linear_prod(b, static_cast<uint32_t>(ec_id));
     diag_kronecker_product_test(ec, *b.examples[ec_id], *b.kprod_ec, b.oas);
     b.kprod_ec->l.simple = {reward};
     auto& simple_red_features = b.kprod_ec->ex_reduction_features.template get<VW::simple_label_reduction_features>();
@@ -810,8 +831,8 @@ void route_to_leaf(memory_tree& b, learner& base, const uint32_t& ec_array_index
   }
   else
   {
-    multilabels = ec.l.multilabels;
-    preds = ec.pred.multilabels;
+    multilabels = std::move(ec.l.multilabels);
+    preds = std::move(ec.pred.multilabels);
   }
 
   path.clear();
@@ -834,8 +855,8 @@ void route_to_leaf(memory_tree& b, learner& base, const uint32_t& ec_array_index
   }
   else
   {
-    ec.pred.multilabels = preds;
-    ec.l.multilabels = multilabels;
+    ec.pred.multilabels = std::move(preds);
+    ec.l.multilabels = std::move(multilabels);
   }
 
   if (insertion == true)
@@ -851,7 +872,7 @@ void route_to_leaf(memory_tree& b, learner& base, const uint32_t& ec_array_index
 // we roll in, then stop at a random step, do exploration. //no real insertion happens in the function.
 void single_query_and_learn(memory_tree& b, learner& base, const uint32_t& ec_array_index, VW::example& ec)
 {
-  VW::v_array<uint64_t> path_to_leaf;
+  auto& path_to_leaf = b.path;
   route_to_leaf(b, base, ec_array_index, 0, path_to_leaf, false);  // no insertion happens here.
 
   if (path_to_leaf.size() > 1)
@@ -888,8 +909,8 @@ void single_query_and_learn(memory_tree& b, learner& base, const uint32_t& ec_ar
       if (b.oas == false) { mc = ec.l.multi; }
       else
       {
-        multilabels = ec.l.multilabels;
-        preds = ec.pred.multilabels;
+        multilabels = std::move(ec.l.multilabels);
+        preds = std::move(ec.pred.multilabels);
       }
 
       ec.weight = std::fabs(objective);
@@ -905,8 +926,8 @@ void single_query_and_learn(memory_tree& b, learner& base, const uint32_t& ec_ar
       if (b.oas == false) { ec.l.multi = mc; }
       else
       {
-        ec.pred.multilabels = preds;
-        ec.l.multilabels = multilabels;
+        ec.pred.multilabels = std::move(preds);
+        ec.l.multilabels = std::move(multilabels);
       }
       ec.weight = ec_input_weight;  // restore the original weight
     }
@@ -978,8 +999,7 @@ void experience_replay(memory_tree& b, learner& base)
     {
       if (b.dream_at_update == false)
       {
-        VW::v_array<uint64_t> tmp_path;
-        route_to_leaf(b, base, ec_id, 0, tmp_path, true);
+        route_to_leaf(b, base, ec_id, 0, b.path, true);
       }
       else { insert_example(b, base, ec_id); }
     }
@@ -1176,6 +1196,9 @@ void save_load_memory_tree(memory_tree& b, VW::io_buf& model_file, bool read, bo
         VW::example* new_ec = new VW::example;
         b.examples.push_back(new_ec);
       }
+      // The flattened features belong to the examples being replaced, they are flattened again on first use.
+      b.flat_memories.clear();
+      b.flat_memories.resize(b.examples.size());
     }
     for (uint32_t i = 0; i < n_examples; i++)
     {
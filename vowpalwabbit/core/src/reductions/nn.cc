@@ -54,6 +54,7 @@ public:
 
   VW::polyprediction* hidden_units_pred = nullptr;
   VW::polyprediction* hiddenbias_pred = nullptr;
+  VW::polyprediction* output_weights_pred = nullptr;
 
   VW::workspace* all = nullptr;  // many things
   std::shared_ptr<VW::rand_state> random_state;
@@ -64,6 +65,7 @@ public:
     free(dropped_out);
     free(hidden_units_pred);
     free(hiddenbias_pred);
+    free(output_weights_pred);
   }
 };
 
@@ -145,6 +147,15 @@ void finish_setup(nn& n, VW::workspace& all)
   n.finished_setup = true;
 }
 
+// Output weight i sits at the index of output feature i, k models up. The output feature indices are
+// feature_width_below apart, so all k output weights are read with one multipredict starting from feature 0.
+void predict_output_weights(nn& n, learner& base)
+{
+  n.outputweight.feature_space[VW::details::NN_OUTPUT_NAMESPACE].indices[0] =
+      n.output_layer.feature_space[VW::details::NN_OUTPUT_NAMESPACE].indices[0];
+  base.multipredict(n.outputweight, n.k, n.k, n.output_weights_pred, true);
+}
+
 void end_pass(nn& n)
 {
   if (n.all->reduction_state.bfgs) { n.xsubi = n.save_xsubi; }
@@ -251,24 +262,28 @@ void predict_or_learn_multi(nn& n, learner& base, VW::example& ec)
     save_max_label = n.all->sd->max_label;
     n.all->sd->max_label = 1;
 
+    VW::features& out_fs = n.output_layer.feature_space[VW::details::NN_OUTPUT_NAMESPACE];
     for (unsigned int i = 0; i < n.k; ++i)
     {
-      float sigmah = (dropped_out[i]) ? 0.0f : dropscale * fasttanh(hidden_units[i].scalar);
-      VW::features& out_fs = n.output_layer.feature_space[VW::details::NN_OUTPUT_NAMESPACE];
-      out_fs.values[i] = sigmah;
-      out_fs.sum_feat_sq += sigmah * sigmah;
-
-      n.outputweight.feature_space[VW::details::NN_OUTPUT_NAMESPACE].indices[0] = out_fs.indices[i];
-      base.predict(n.outputweight, n.k);
-      float wf = n.outputweight.pred.scalar;
+      out_fs.values[i] = (dropped_out[i]) ? 0.0f : dropscale * fasttanh(hidden_units[i].scalar);
+    }
+    for (unsigned int i = 0; i < n.k; ++i) { out_fs.sum_feat_sq += out_fs.values[i] * out_fs.values[i]; }
 
+    predict_output_weights(n, base);
+    for (unsigned int i = 0; i < n.k; ++i)
+    {
       // avoid saddle point at 0
-      if (wf == 0)
+      if (n.output_weights_pred[i].scalar == 0)
       {
         float sqrtk = std::sqrt(static_cast<float>(n.k));
+        n.outputweight.feature_space[VW::details::NN_OUTPUT_NAMESPACE].indices[0] = out_fs.indices[i];
+        n.outputweight.pred.scalar = 0;
+        n.outputweight.partial_prediction = 0;
         n.outputweight.l.simple.label = static_cast<float>(n.random_state->get_and_update_random() - 0.5) / sqrtk;
         base.update(n.outputweight, n.k);
         n.outputweight.l.simple.label = FLT_MAX;
+        // With l1 or l2 regularization the update rescales every weight.
+        if (n.all->loss_config.reg_mode != 0) { predict_output_weights(n, base); }
       }
     }
 
@@ -344,16 +359,24 @@ void predict_or_learn_multi(nn& n, learner& base, VW::example& ec)
 
           if (n.multitask) { ec.ft_offset = 0; }
 
+          // The output weights were just learned, read them again. With l1 or l2 regularization every hidden unit
+          // update rescales the weights, so each output weight has to be read right before its unit is updated.
+          const bool batch_output_weights = n.all->loss_config.reg_mode == 0;
+          if (batch_output_weights) { predict_output_weights(n, base); }
           for (unsigned int i = 0; i < n.k; ++i)
           {
             if (!dropped_out[i])
             {
               float sigmah = n.output_layer.feature_space[VW::details::NN_OUTPUT_NAMESPACE].values[i] / dropscale;
               float sigmahprime = dropscale * (1.0f - sigmah * sigmah);
-              n.outputweight.feature_space[VW::details::NN_OUTPUT_NAMESPACE].indices[0] =
-                  n.output_layer.feature_space[VW::details::NN_OUTPUT_NAMESPACE].indices[i];
-              base.predict(n.outputweight, n.k);
-              float nu = n.outputweight.pred.scalar;
+              float nu = n.output_weights_pred[i].scalar;
+              if (!batch_output_weights)
+              {
+                n.outputweight.feature_space[VW::details::NN_OUTPUT_NAMESPACE].indices[0] =
+                    n.output_layer.feature_space[VW::details::NN_OUTPUT_NAMESPACE].indices[i];
+                base.predict(n.outputweight, n.k);
+                nu = n.outputweight.pred.scalar;
+              }
               float gradhw = 0.5f * nu * gradient * sigmahprime;
 
               ec.l.simple.label =
@@ -485,6 +508,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::nn_setup(VW::setup_base_i&
   n->dropped_out = VW::details::calloc_or_throw<bool>(n->k);
   n->hidden_units_pred = VW::details::calloc_or_throw<VW::polyprediction>(n->k);
   n->hiddenbias_pred = VW::details::calloc_or_throw<VW::polyprediction>(n->k);
+  n->output_weights_pred = VW::details::calloc_or_throw<VW::polyprediction>(n->k);
 
   size_t feature_width = n->k + 1;
   auto base = require_singleline(stack_builder.setup_base_learner(feature_width));
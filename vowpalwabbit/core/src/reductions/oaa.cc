@@ -12,6 +12,7 @@
 #include "vw/core/multiclass.h"
 #include "vw/core/named_labels.h"
 #include "vw/core/prediction_type.h"
+#include "vw/core/scope_exit.h"
 #include "vw/core/setup_base.h"
 #include "vw/core/shared_data.h"
 #include "vw/core/vw.h"
@@ -39,6 +40,8 @@ public:
   uint64_t num_subsample = 0;           // for randomized subsampling, how many negatives to draw?
   uint32_t* subsample_order = nullptr;  // for randomized subsampling, in what order should we touch classes
   size_t subsample_id = 0;              // for randomized subsampling, where do we live in the list
+  bool sparse_class_index = false;      // score only the classes with weights on the example's features
+  VW::class_index::posting_lists class_index;
   VW::io::logger logger;
   // Default value of 2 follows behavior of 1-indexing and can change to 0-indexing if detected
   uint32_t& indexing;  // for 0 or 1 indexing
@@ -52,6 +55,15 @@ public:
   }
 };
 
+// With --sparse_class_index gd scores and learns the classes of ec through o.class_index until the returned features
+// are reset.
+VW::class_index::reduction_features& use_class_index(oaa& o, VW::LEARNER::learner& base, VW::example& ec)
+{
+  auto& classes = ec.ex_reduction_features.template get<VW::class_index::reduction_features>();
+  if (o.sparse_class_index) { classes.set(o.class_index, ec.ft_offset, o.k, base.feature_width_below); }
+  return classes;
+}
+
 void learn_randomized(oaa& o, VW::LEARNER::learner& base, VW::example& ec)
 {
   // Update indexing
@@ -84,6 +96,8 @@ void learn_randomized(oaa& o, VW::LEARNER::learner& base, VW::example& ec)
   ec.ex_reduction_features.template get<VW::simple_label_reduction_features>().reset_to_default();
   uint32_t lbl_ind = (o.indexing == 0) ? ld.label : ld.label - 1;
 
+  auto& classes = use_class_index(o, base, ec);
+  auto class_index_guard = VW::scope_exit([&classes] { classes.reset_to_default(); });
   base.learn(ec, lbl_ind);
 
   size_t prediction = ld.label;
@@ -150,6 +164,8 @@ void learn(oaa& o, VW::LEARNER::learner& base, VW::example& ec)
   ec.l.simple = {FLT_MAX};
   ec.ex_reduction_features.template get<VW::simple_label_reduction_features>().reset_to_default();
 
+  auto& classes = use_class_index(o, base, ec);
+  auto class_index_guard = VW::scope_exit([&classes] { classes.reset_to_default(); });
   for (uint32_t i = 0; i < o.k; i++)
   {
     uint32_t lbl = (o.indexing == 0) ? i : i + 1;
@@ -179,7 +195,11 @@ void predict(oaa& o, VW::LEARNER::learner& base, VW::example& ec)
 
   // oaa.pred - Predictions will get stored in this array
   // oaa.k    - Number of learners to call predict() on
-  base.multipredict(ec, 0, o.k, o.pred, true);
+  {
+    auto& classes = use_class_index(o, base, ec);
+    auto class_index_guard = VW::scope_exit([&classes] { classes.reset_to_default(); });
+    base.multipredict(ec, 0, o.k, o.pred, true);
+  }
 
   // Find the class with the largest score (index +1)
   uint32_t prediction = 0;
@@ -337,6 +357,9 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::oaa_setup(VW::setup_base_i
   new_options.add(make_option("oaa", data->k).keep().necessary().help("One-against-all multiclass with <k> labels"))
       .add(make_option("oaa_subsample", data->num_subsample)
                .help("Subsample this number of negative examples when learning"))
+      .add(make_option("sparse_class_index", data->sparse_class_index)
+               .help("Keep per feature lists of the classes with non zero weights and only score those. Helps when "
+                     "most classes have no weight on the features of an example"))
       .add(make_option("probabilities", probabilities).help("Predict probabilities of all classes"))
       .add(make_option("scores", scores).help("Output raw scores per class"))
       .add(make_option("indexing", all.runtime_state.indexing)
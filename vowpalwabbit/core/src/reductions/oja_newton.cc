@@ -14,6 +14,10 @@
 #include "vw/core/vw.h"
 #include "vw/core/vw_fwd.h"
 
+// Keep the alignment the same as the large action space code, which is built into the same library.
+#define EIGEN_MAX_ALIGN_BYTES 32
+
+#include <Eigen/Dense>
 #include <cmath>
 #include <memory>
 #include <string>
@@ -25,6 +29,11 @@ using namespace VW::config;
 
 namespace
 {
+using sketch_matrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+// Slots 1 to m of a weight hold its row of the sketch Z.
+Eigen::Map<Eigen::VectorXf> sketch_weights(float* w, int m) { return Eigen::Map<Eigen::VectorXf>(w + 1, m); }
+
 class OjaNewton;
 class oja_n_update_data
 {
@@ -33,9 +42,9 @@ public:
   float g = 0.f;
   float sketch_cnt = 0.f;
   float norm2_x = 0.f;
-  std::vector<float> Zx;   // NOLINT
-  std::vector<float> AZx;  // NOLINT
-  std::vector<float> delta;
+  Eigen::VectorXf Zx;   // NOLINT
+  Eigen::VectorXf AZx;  // NOLINT
+  Eigen::VectorXf delta;
   float bdelta = 0.f;
   float prediction = 0.f;
 };
@@ -51,15 +60,16 @@ public:
   uint64_t cnt = 0;
   int t = 0;
 
-  std::vector<float> ev;
-  std::vector<float> b;
-  std::vector<float> D;               // NOLINT
-  std::vector<std::vector<float>> A;  // NOLINT
-  std::vector<std::vector<float>> K;  // NOLINT
+  // Entry i of the vectors and row i of the matrices belong to sketch direction i, which is stored in weight slot i + 1.
+  Eigen::VectorXf ev;
+  Eigen::VectorXf b;
+  Eigen::VectorXf D;  // NOLINT
+  sketch_matrix A;    // NOLINT lower triangular
+  sketch_matrix K;    // NOLINT
 
-  std::vector<float> zv;
-  std::vector<float> vv;
-  std::vector<float> tmp;
+  Eigen::VectorXf zv;
+  Eigen::VectorXf vv;
+  Eigen::VectorXf tmp;
 
   std::vector<VW::example*> buffer;
   // If the epoch size is greater than 1, the examples in the batch need to be saved somewhere.
@@ -109,46 +119,41 @@ public:
       }
     }
 
-    // Gram-Schmidt
-    for (int j = 1; j <= m; j++)
+    // Orthonormalize the columns of Z. This is the Q of its QR decomposition, which two rounds of Cholesky QR compute
+    // with one sweep over the weights to accumulate Z'Z and one to multiply every row by the inverse of its factor.
+    Eigen::VectorXd row(m);
+    for (int round = 0; round < 2; round++)
     {
-      for (int k = 1; k <= j - 1; k++)
+      Eigen::MatrixXd gram = Eigen::MatrixXd::Zero(m, m);
+      for (uint32_t i = 0; i < length; i++)
       {
-        double temp = 0;
-
-        for (uint32_t i = 0; i < length; i++)
-        {
-          temp += (static_cast<double>((&(weights.strided_index(i)))[j])) * (&(weights.strided_index(i)))[k];
-        }
-        for (uint32_t i = 0; i < length; i++)
-        {
-          (&(weights.strided_index(i)))[j] -= static_cast<float>(temp) * (&(weights.strided_index(i)))[k];
-        }
+        row = sketch_weights(&(weights.strided_index(i)), m).cast<double>();
+        gram.selfadjointView<Eigen::Lower>().rankUpdate(row);
       }
-      double norm = 0;
+      sketch_matrix r_inverse = gram.selfadjointView<Eigen::Lower>()
+                                    .llt()
+                                    .matrixU()
+                                    .solve(Eigen::MatrixXd::Identity(m, m))
+                                    .cast<float>();
       for (uint32_t i = 0; i < length; i++)
       {
-        norm += (static_cast<double>((&(weights.strided_index(i)))[j])) * (&(weights.strided_index(i)))[j];
+        auto z = sketch_weights(&(weights.strided_index(i)), m);
+        tmp.noalias() = r_inverse.triangularView<Eigen::Upper>().transpose() * z;
+        z = tmp;
       }
-      norm = std::sqrt(norm);
-      for (uint32_t i = 0; i < length; i++) { (&(weights.strided_index(i)))[j] /= static_cast<float>(norm); }
     }
   }
 
   void compute_AZx()  // NOLINT
   {
-    for (int i = 1; i <= m; i++)
-    {
-      data.AZx[i] = 0;
-      for (int j = 1; j <= i; j++) { data.AZx[i] += A[i][j] * data.Zx[j]; }
-    }
+    data.AZx.noalias() = A.triangularView<Eigen::Lower>() * data.Zx;
   }
 
   void update_eigenvalues()
   {
-    for (int i = 1; i <= m; i++)
+    float gamma = std::fmin(learning_rate_cnt / t, 1.f);
+    for (int i = 0; i < m; i++)
     {
-      float gamma = std::fmin(learning_rate_cnt / t, 1.f);
       float temp = data.AZx[i] * data.sketch_cnt;
 
       if (t == 1) { ev[i] = gamma * temp * temp; }
@@ -159,16 +164,15 @@ public:
   void compute_delta()
   {
     data.bdelta = 0;
-    for (int i = 1; i <= m; i++)
+    float gamma = std::fmin(learning_rate_cnt / t, 1.f);
+    for (int i = 0; i < m; i++)
     {
-      float gamma = std::fmin(learning_rate_cnt / t, 1.f);
-
       // if different learning rates are used
       /*data.delta[i] = gamma * data.AZx[i] * data.sketch_cnt;
-      for (int j = 1; j < i; j++) {
-          data.delta[i] -= A[i][j] * data.delta[j];
+      for (int j = 0; j < i; j++) {
+          data.delta[i] -= A(i, j) * data.delta[j];
       }
-      data.delta[i] /= A[i][i];*/
+      data.delta[i] /= A(i, i);*/
 
       // if a same learning rate is used
       data.delta[i] = gamma * data.Zx[i] * data.sketch_cnt;
@@ -179,157 +183,79 @@ public:
 
   void update_K()  // NOLINT
   {
+    // K += delta Zx' + Zx delta' (scaled by sketch_cnt) + delta delta' (scaled by |x|^2 sketch_cnt^2)
     float temp = data.norm2_x * data.sketch_cnt * data.sketch_cnt;
-    for (int i = 1; i <= m; i++)
-    {
-      for (int j = 1; j <= m; j++)
-      {
-        K[i][j] += data.delta[i] * data.Zx[j] * data.sketch_cnt;
-        K[i][j] += data.delta[j] * data.Zx[i] * data.sketch_cnt;
-        K[i][j] += data.delta[i] * data.delta[j] * temp;
-      }
-    }
+    tmp = data.sketch_cnt * data.Zx + temp * data.delta;
+    K.noalias() += data.delta * tmp.transpose();
+    K.noalias() += (data.sketch_cnt * data.Zx) * data.delta.transpose();
   }
 
   void update_A()  // NOLINT
   {
-    for (int i = 1; i <= m; i++)
+    // Rows are made K-orthonormal one after the other, each against the rows above it.
+    for (int i = 0; i < m; i++)
     {
-      for (int j = 1; j < i; j++)
+      auto row = A.row(i).head(i + 1);
+      if (i > 0)
       {
-        zv[j] = 0;
-        for (int k = 1; k <= i; k++) { zv[j] += A[i][k] * K[k][j]; }
+        auto above = A.topLeftCorner(i, i).triangularView<Eigen::Lower>();
+        zv.head(i).noalias() = (row * K.topLeftCorner(i + 1, i)).transpose();
+        vv.head(i).noalias() = above * zv.head(i);
+        A.row(i).head(i).noalias() -= vv.head(i).transpose() * above;
       }
 
-      for (int j = 1; j < i; j++)
-      {
-        vv[j] = 0;
-        for (int k = 1; k <= j; k++) { vv[j] += A[j][k] * zv[k]; }
-      }
-
-      for (int j = 1; j < i; j++)
-      {
-        for (int k = j; k < i; k++) { A[i][j] -= vv[k] * A[k][j]; }
-      }
-
-      float norm = 0;
-      for (int j = 1; j <= i; j++)
-      {
-        float temp = 0;
-        for (int k = 1; k <= i; k++) { temp += K[j][k] * A[i][k]; }
-        norm += A[i][j] * temp;
-      }
-      norm = sqrtf(norm);
-
-      for (int j = 1; j <= i; j++) { A[i][j] /= norm; }
+      float norm = std::sqrt(row.dot(row * K.topLeftCorner(i + 1, i + 1).transpose()));
+      row /= norm;
     }
   }
 
   void update_b()
   {
-    for (int j = 1; j <= m; j++)
-    {
-      float temp = 0;
-      for (int i = j; i <= m; i++) { temp += ev[i] * data.AZx[i] * A[i][j] / (alpha * (alpha + ev[i])); }
-      b[j] += temp * data.g;
-    }
+    for (int i = 0; i < m; i++) { tmp[i] = ev[i] * data.AZx[i] / (alpha * (alpha + ev[i])); }
+    b.noalias() += A.triangularView<Eigen::Lower>().transpose() * (data.g * tmp);
   }
 
   void update_D()  // NOLINT
   {
-    for (int j = 1; j <= m; j++)
+    for (int j = 0; j < m; j++)
     {
-      float scale = std::fabs(A[j][j]);
-      for (int i = j + 1; i <= m; i++) { scale = std::fmin(std::fabs(A[i][j]), scale); }
+      float scale = A.col(j).tail(m - j).cwiseAbs().minCoeff();
       if (scale < 1e-10) { continue; }
-      for (int i = 1; i <= m; i++)
-      {
-        A[i][j] /= scale;
-        K[j][i] *= scale;
-        K[i][j] *= scale;
-      }
+      A.col(j) /= scale;
+      K.row(j) *= scale;
+      K.col(j) *= scale;
       b[j] /= scale;
       D[j] *= scale;
-      // printf("D[%d] = %f\n", j, D[j]);
     }
   }
 
   void check()
   {
     double max_norm = 0;
-    for (int i = 1; i <= m; i++)
-    {
-      for (int j = i; j <= m; j++) { max_norm = fmax(max_norm, std::fabs(K[i][j])); }
-    }
-    // printf("|K| = %f\n", max_norm);
+    for (int i = 0; i < m; i++) { max_norm = fmax(max_norm, K.row(i).tail(m - i).cwiseAbs().maxCoeff()); }
     if (max_norm < 1e7) { return; }
 
     // implicit -> explicit representation
-    // printf("begin conversion: t = %d, norm(K) = %f\n", t, max_norm);
 
     // first step: K <- AKA'
-
-    // K <- AK
-    for (int j = 1; j <= m; j++)
-    {
-      std::fill(tmp.begin(), tmp.end(), 0.f);
-
-      for (int i = 1; i <= m; i++)
-      {
-        for (int h = 1; h <= m; h++) { tmp[i] += A[i][h] * K[h][j]; }
-      }
-
-      for (int i = 1; i <= m; i++) { K[i][j] = tmp[i]; }
-    }
-    // K <- KA'
-    for (int i = 1; i <= m; i++)
-    {
-      std::fill(tmp.begin(), tmp.end(), 0.f);
-
-      for (int j = 1; j <= m; j++)
-      {
-        for (int h = 1; h <= m; h++) { tmp[j] += K[i][h] * A[j][h]; }
-      }
-
-      for (int j = 1; j <= m; j++) { K[i][j] = tmp[j]; }
-    }
+    K = A * K * A.transpose();
 
     // second step: w[0] <- w[0] + (DZ)'b, b <- 0.
-
+    // third step: Z <- ADZ, A, D <- Identity
+    vv = b.cwiseProduct(D);
     uint32_t length = 1 << all->initial_weights_config.num_bits;
     for (uint32_t i = 0; i < length; i++)
     {
       VW::weight& w = all->weights.strided_index(i);
-      for (int j = 1; j <= m; j++) { w += (&w)[j] * b[j] * D[j]; }
+      auto z = sketch_weights(&w, m);
+      w += z.dot(vv);
+      tmp.noalias() = A.triangularView<Eigen::Lower>() * D.cwiseProduct(z);
+      z = tmp;
     }
 
-    std::fill(b.begin(), b.end(), 0.f);
-
-    // third step: Z <- ADZ, A, D <- Identity
-
-    // double norm = 0;
-    for (uint32_t i = 0; i < length; ++i)
-    {
-      std::fill(tmp.begin(), tmp.end(), 0.f);
-      VW::weight& w = all->weights.strided_index(i);
-      for (int j = 1; j <= m; j++)
-      {
-        for (int h = 1; h <= m; ++h) { tmp[j] += A[j][h] * D[h] * (&w)[h]; }
-      }
-      for (int j = 1; j <= m; ++j)
-      {
-        // norm = std::max(norm, fabs(tmp[j]));
-        (&w)[j] = tmp[j];
-      }
-    }
-    // printf("|Z| = %f\n", norm);
-
-    for (int i = 1; i <= m; i++)
-    {
-      std::fill(A[i].begin(), A[i].end(), 0.f);
-      D[i] = 1;
-      A[i][i] = 1;
-    }
+    b.setZero();
+    A.setIdentity();
+    D.setOnes();
   }
 };
 
@@ -341,7 +267,7 @@ void make_pred(oja_n_update_data& data, float x, float& wref)
   if (data.oja_newton_ptr->normalize) { x /= std::sqrt(w[NORM2]); }
 
   data.prediction += w[0] * x;
-  for (int i = 1; i <= m; i++) { data.prediction += w[i] * x * data.oja_newton_ptr->D[i] * data.oja_newton_ptr->b[i]; }
+  data.prediction += x * sketch_weights(w, m).cwiseProduct(data.oja_newton_ptr->D).dot(data.oja_newton_ptr->b);
 }
 
 void predict(OjaNewton& oja_newton_ptr, VW::example& ec)
@@ -360,7 +286,7 @@ void update_Z_and_wbar(oja_n_update_data& data, float x, float& wref)  // NOLINT
   if (data.oja_newton_ptr->normalize) { x /= std::sqrt(w[NORM2]); }
   float s = data.sketch_cnt * x;
 
-  for (int i = 1; i <= m; i++) { w[i] += data.delta[i] * s / data.oja_newton_ptr->D[i]; }
+  sketch_weights(w, m) += (s * data.delta).cwiseQuotient(data.oja_newton_ptr->D);
   w[0] -= s * data.bdelta;
 }
 
@@ -370,7 +296,7 @@ void compute_Zx_and_norm(oja_n_update_data& data, float x, float& wref)  // NOLI
   int m = data.oja_newton_ptr->m;
   if (data.oja_newton_ptr->normalize) { x /= std::sqrt(w[NORM2]); }
 
-  for (int i = 1; i <= m; i++) { data.Zx[i] += w[i] * x * data.oja_newton_ptr->D[i]; }
+  data.Zx += (x * sketch_weights(w, m)).cwiseProduct(data.oja_newton_ptr->D);
   data.norm2_x += x * x;
 }
 
@@ -382,7 +308,7 @@ void update_wbar_and_Zx(oja_n_update_data& data, float x, float& wref)  // NOLIN
 
   float g = data.g * x;
 
-  for (int i = 1; i <= m; i++) { data.Zx[i] += w[i] * x * data.oja_newton_ptr->D[i]; }
+  data.Zx += (x * sketch_weights(w, m)).cwiseProduct(data.oja_newton_ptr->D);
   w[0] -= g / data.oja_newton_ptr->alpha;
 }
 
@@ -438,7 +364,7 @@ void learn(OjaNewton& oja_newton_ptr, VW::example& ec)
       data.sketch_cnt = oja_newton_ptr.weight_buffer[k];
 
       data.norm2_x = 0;
-      std::fill(data.Zx.begin(), data.Zx.end(), 0.f);
+      data.Zx.setZero();
       VW::foreach_feature<oja_n_update_data, compute_Zx_and_norm>(*oja_newton_ptr.all, ex, data);
       oja_newton_ptr.compute_AZx();
 
@@ -457,7 +383,7 @@ void learn(OjaNewton& oja_newton_ptr, VW::example& ec)
     oja_newton_ptr.cnt = 0;
   }
 
-  std::fill(data.Zx.begin(), data.Zx.end(), 0.f);
+  data.Zx.setZero();
   VW::foreach_feature<oja_n_update_data, update_wbar_and_Zx>(*oja_newton_ptr.all, ec, data);
   oja_newton_ptr.compute_AZx();
 
@@ -527,19 +453,14 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::oja_newton_setup(VW::setup
 
   if (options.was_supplied("alpha_inverse")) { oja_newton_ptr->alpha = 1.f / alpha_inverse; }
 
-  const size_t buffer_size = oja_newton_ptr->m + 1;
+  const int m = oja_newton_ptr->m;
   oja_newton_ptr->cnt = 0;
   oja_newton_ptr->t = 1;
-  oja_newton_ptr->ev = std::vector<float>(buffer_size, 0.f);
-  oja_newton_ptr->b = std::vector<float>(buffer_size, 0.f);
-  oja_newton_ptr->D = std::vector<float>(buffer_size, 1.f);
-  oja_newton_ptr->A = std::vector<std::vector<float>>(buffer_size, std::vector<float>(buffer_size, 0.f));
-  oja_newton_ptr->K = std::vector<std::vector<float>>(buffer_size, std::vector<float>(buffer_size, 0.f));
-  for (int i = 1; i <= oja_newton_ptr->m; i++)
-  {
-    oja_newton_ptr->A[i][i] = 1.f;
-    oja_newton_ptr->K[i][i] = 1.f;
-  }
+  oja_newton_ptr->ev = Eigen::VectorXf::Zero(m);
+  oja_newton_ptr->b = Eigen::VectorXf::Zero(m);
+  oja_newton_ptr->D = Eigen::VectorXf::Ones(m);
+  oja_newton_ptr->A = sketch_matrix::Identity(m, m);
+  oja_newton_ptr->K = sketch_matrix::Identity(m, m);
 
   oja_newton_ptr->buffer = std::vector<VW::example*>(oja_newton_ptr->epoch_size, nullptr);
   oja_newton_ptr->weight_buffer = std::vector<float>(oja_newton_ptr->epoch_size, 0.f);
@@ -552,14 +473,14 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::oja_newton_setup(VW::setup
     }
   }
 
-  oja_newton_ptr->zv = std::vector<float>(buffer_size, 0.f);
-  oja_newton_ptr->vv = std::vector<float>(buffer_size, 0.f);
-  oja_newton_ptr->tmp = std::vector<float>(buffer_size, 0.f);
+  oja_newton_ptr->zv = Eigen::VectorXf::Zero(m);
+  oja_newton_ptr->vv = Eigen::VectorXf::Zero(m);
+  oja_newton_ptr->tmp = Eigen::VectorXf::Zero(m);
 
   oja_newton_ptr->data.oja_newton_ptr = oja_newton_ptr.get();
-  oja_newton_ptr->data.Zx = std::vector<float>(buffer_size, 0.f);
-  oja_newton_ptr->data.AZx = std::vector<float>(buffer_size, 0.f);
-  oja_newton_ptr->data.delta = std::vector<float>(buffer_size, 0.f);
+  oja_newton_ptr->data.Zx = Eigen::VectorXf::Zero(m);
+  oja_newton_ptr->data.AZx = Eigen::VectorXf::Zero(m);
+  oja_newton_ptr->data.delta = Eigen::VectorXf::Zero(m);
 
   all.weights.stride_shift(static_cast<uint32_t>(std::ceil(std::log2(oja_newton_ptr->m + 2))));
 
@@ -21,7 +21,6 @@
 #include <cstdio>
 #include <queue>
 #include <sstream>
-#include <unordered_set>
 #include <vector>
 
 using namespace VW::LEARNER;
@@ -50,9 +49,9 @@ public:
   uint32_t kary = 0;  // kary tree
 
   // for training
-  VW::v_array<float> nodes_time;                // in case of sgd, this stores individual t for each node
-  std::unordered_set<uint32_t> positive_nodes;  // container for positive nodes
-  std::unordered_set<uint32_t> negative_nodes;  // container for negative nodes
+  VW::v_array<float> nodes_time;        // in case of sgd, this stores individual t for each node
+  std::vector<uint32_t> positive_nodes;  // sorted container for positive nodes
+  std::vector<uint32_t> negative_nodes;  // sorted container for negative nodes
 
   // for prediction
   float threshold = 0.f;
@@ -62,7 +61,7 @@ public:
   bool probabilities = false;
 
   // for measuring predictive performance
-  std::unordered_set<uint32_t> true_labels;
+  std::vector<uint32_t> true_labels;  // sorted
   VW::v_array<float> p_at;  // precision at
   VW::v_array<float> r_at;  // recall at
   uint32_t tp = 0;          // true positives
@@ -90,6 +89,8 @@ inline float learn_node(plt& p, uint32_t n, learner& base, VW::example& ec)
   return ec.loss;
 }
 
+// Nodes are numbered level by level, so the parent of node n is (n - 1) / kary and its children are kary * n + 1 to
+// kary * n + kary. Both containers are kept sorted, which keeps this allocation free once they have grown.
 void get_nodes_to_update(plt& p, VW::multilabel_label& multilabels)
 {
   p.positive_nodes.clear();
@@ -102,36 +103,40 @@ void get_nodes_to_update(plt& p, VW::multilabel_label& multilabels)
       uint32_t tn = label + p.ti;
       if (tn < p.t)
       {
-        p.positive_nodes.insert(tn);
+        p.positive_nodes.push_back(tn);
         while (tn > 0)
         {
-          tn = static_cast<uint32_t>(std::floor(static_cast<float>(tn - 1) / p.kary));
-          p.positive_nodes.insert(tn);
+          tn = (tn - 1) / p.kary;
+          p.positive_nodes.push_back(tn);
         }
       }
     }
+    std::sort(p.positive_nodes.begin(), p.positive_nodes.end());
+    p.positive_nodes.erase(std::unique(p.positive_nodes.begin(), p.positive_nodes.end()), p.positive_nodes.end());
+
     if (multilabels.label_v.back() >= p.k)
     {
       p.all->logger.out_error(
           "label {0} is not in {{0,{1}}} This won't work right.", multilabels.label_v.back(), p.k - 1);
     }
 
-    for (auto& n : p.positive_nodes)
+    // children of increasing parents are increasing, so negative_nodes comes out sorted
+    for (auto n : p.positive_nodes)
     {
       if (n < p.ti)
       {
         for (uint32_t i = 1; i <= p.kary; ++i)
         {
           uint32_t n_child = p.kary * n + i;
-          if (n_child < p.t && p.positive_nodes.find(n_child) == p.positive_nodes.end())
+          if (n_child < p.t && !std::binary_search(p.positive_nodes.begin(), p.positive_nodes.end(), n_child))
           {
-            p.negative_nodes.insert(n_child);
+            p.negative_nodes.push_back(n_child);
           }
         }
       }
     }
   }
-  else { p.negative_nodes.insert(0); }
+  else { p.negative_nodes.push_back(0); }
 }
 
 void learn(plt& p, learner& base, VW::example& ec)
@@ -204,9 +209,11 @@ void predict(plt& p, learner& base, VW::example& ec)
   p.true_labels.clear();
   for (auto label : multilabels.label_v)
   {
-    if (label < p.k) { p.true_labels.insert(label); }
+    if (label < p.k) { p.true_labels.push_back(label); }
     else { p.all->logger.out_error("label {0} is not in {{0,{1}}} This won't work right.", label, p.k - 1); }
   }
+  std::sort(p.true_labels.begin(), p.true_labels.end());
+  p.true_labels.erase(std::unique(p.true_labels.begin(), p.true_labels.end()), p.true_labels.end());
 
   p.node_queue.clear();  // clear node queue
 
@@ -254,7 +261,7 @@ void predict(plt& p, learner& base, VW::example& ec)
       for (uint32_t i = 0; i < pred_size; ++i)
       {
         uint32_t pred_label = pred.multilabels.label_v[i];
-        if (p.true_labels.count(pred_label)) { ++tp; }
+        if (std::binary_search(p.true_labels.begin(), p.true_labels.end(), pred_label)) { ++tp; }
       }
       p.tp += tp;
       p.fp += static_cast<uint32_t>(pred_size) - tp;
@@ -305,7 +312,7 @@ void predict(plt& p, learner& base, VW::example& ec)
       for (size_t i = 0; i < p.top_k; ++i)
       {
         uint32_t pred_label = pred.multilabels.label_v[i];
-        if (p.true_labels.count(pred_label)) { tp_at += 1; }
+        if (std::binary_search(p.true_labels.begin(), p.true_labels.end(), pred_label)) { tp_at += 1; }
         p.p_at[i] += tp_at / (i + 1);
         if (p.true_labels.size() > 0) { p.r_at[i] += tp_at / p.true_labels.size(); }
       }
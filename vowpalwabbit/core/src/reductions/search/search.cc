@@ -44,8 +44,6 @@ using std::endl;
 
 namespace Search
 {
-using byte_array = std::unique_ptr<uint8_t[]>;
-
 std::array<search_task*, 10> all_tasks = {&SequenceTask::task, &SequenceSpanTask::task, &SequenceTaskCostToGo::task,
     &ArgmaxTask::task, &SequenceTask_DemoLDF::task, &MulticlassTask::task, &DepParserTask::task,
     &EntityRelationTask::task, &HookTask::task, &GraphTask::task};
@@ -150,33 +148,98 @@ std::ostream& operator<<(std::ostream& os, const action_cache& x)
 
 void clear_memo_foreach_action(search_private& priv);
 
-class search_private
+// Maps the serialized key of a prediction (tag, policy, learner and conditioning) to the action predicted for it.
+// This is an open addressing table whose keys are copied into a single byte buffer. Clearing only bumps a generation
+// counter, so once the table has grown to fit the predictions of a sequence it does not allocate anymore.
+class prediction_cache
 {
+public:
+  void clear()
+  {
+    _keys.clear();
+    _count = 0;
+    if (++_generation == 0)
+    {
+      for (auto& s : _slots) { s.generation = 0; }
+      _generation = 1;
+    }
+  }
+
+  // Like std::unordered_map::emplace, a key which is already present keeps its value.
+  void insert(const uint8_t* key, size_t size, const scored_action& value)
+  {
+    if ((_count + 1) * 2 > _slots.size()) { grow(); }
+    const uint64_t hash = hash_key(key, size);
+    slot* s = probe(key, size, hash);
+    if (s->generation == _generation) { return; }
+
+    s->generation = _generation;
+    s->hash = hash;
+    s->key_offset = _keys.size();
+    s->key_size = size;
+    s->value = value;
+    _keys.insert(_keys.end(), key, key + size);
+    _count++;
+  }
+
+  const scored_action* find(const uint8_t* key, size_t size)
+  {
+    if (_count == 0) { return nullptr; }
+    const slot* s = probe(key, size, hash_key(key, size));
+    return s->generation == _generation ? &s->value : nullptr;
+  }
+
 private:
-  class cached_item_equivalent
+  class slot
   {
   public:
-    bool operator()(const byte_array& lhs, const byte_array& rhs) const
+    uint64_t hash = 0;
+    size_t key_offset = 0;
+    size_t key_size = 0;
+    uint32_t generation = 0;
+    scored_action value;
+  };
+
+  static uint64_t hash_key(const uint8_t* key, size_t size)
+  {
+    return VW::uniform_hash(reinterpret_cast<const char*>(key), size, static_cast<uint32_t>(SEARCH_HASH_SEED));
+  }
+
+  // Returns the slot holding the key, or the empty slot where it would be inserted.
+  slot* probe(const uint8_t* key, size_t size, uint64_t hash)
+  {
+    const size_t mask = _slots.size() - 1;
+    for (size_t i = static_cast<size_t>(hash) & mask;; i = (i + 1) & mask)
     {
-      size_t sz_lhs = *lhs.get();
-      size_t sz_rhs = *rhs.get();
-      if (sz_lhs != sz_rhs) { return false; }
-      return memcmp(lhs.get(), rhs.get(), sz_lhs) == 0;
+      slot& s = _slots[i];
+      if (s.generation != _generation) { return &s; }
+      if (s.hash == hash && s.key_size == size && memcmp(_keys.data() + s.key_offset, key, size) == 0) { return &s; }
     }
-  };
-  class cached_item_hash
+  }
+
+  void grow()
   {
-  public:
-    size_t operator()(const byte_array& key) const
+    std::vector<slot> old_slots(std::max<size_t>(64, _slots.size() * 2));
+    old_slots.swap(_slots);
+    for (const auto& old : old_slots)
     {
-      size_t sz = *key.get();
-      return VW::uniform_hash(reinterpret_cast<const char*>(key.get()), sz, static_cast<uint32_t>(SEARCH_HASH_SEED));
+      if (old.generation != _generation) { continue; }
+      const size_t mask = _slots.size() - 1;
+      size_t i = static_cast<size_t>(old.hash) & mask;
+      while (_slots[i].generation == _generation) { i = (i + 1) & mask; }
+      _slots[i] = old;
     }
-  };
+  }
 
-public:
-  using cache_map = std::unordered_map<byte_array, scored_action, cached_item_hash, cached_item_equivalent>;
+  std::vector<slot> _slots;
+  std::vector<uint8_t> _keys;
+  size_t _count = 0;
+  uint32_t _generation = 1;
+};
 
+class search_private
+{
+public:
   VW::workspace* all = nullptr;
   std::shared_ptr<VW::rand_state> random_state;
 
@@ -277,7 +340,8 @@ public:
   size_t total_predictions_made = 0;
   size_t total_cache_hits = 0;
 
-  cache_map cache_hash_map;
+  prediction_cache cache_hash_map;
+  std::vector<uint8_t> cache_key;  // reused to serialize the key of each lookup
 
   // for foreach_feature temporary storage for conditioning
   uint64_t dat_new_feature_idx = 0;
@@ -1439,8 +1503,8 @@ bool cached_action_store_or_find(search_private& priv, ptag mytag, const ptag* c
     sz += 4 - (sz % 4);  // make sure sz aligns to 4 so that uniform_hash does the right thing
   }
 
-  byte_array item(new uint8_t[sz]);
-  uint8_t* here = item.get();
+  priv.cache_key.resize(sz);
+  uint8_t* here = priv.cache_key.data();
   // get rid of a valgrind warning about uninitialized memory
   memset(here, 0, sz);
   *here = static_cast<unsigned char>(sz);
@@ -1462,17 +1526,20 @@ bool cached_action_store_or_find(search_private& priv, ptag mytag, const ptag* c
     *here = condition_on_names[i];
     here += sizeof(char);  // SPEEDUP: should we align this at 4?
   }
+  // The cache has always hashed and compared keys by the size stored in their first byte, which is truncated to 8
+  // bits. Keys longer than 255 bytes are therefore still looked up by that prefix, so they hit the same entries.
+  const size_t key_size = priv.cache_key[0];
   if (do_store)
   {
-    priv.cache_hash_map.emplace(std::move(item), scored_action(a, a_cost));
+    priv.cache_hash_map.insert(priv.cache_key.data(), key_size, scored_action(a, a_cost));
     return true;
   }
   else  // its a find
   {
-    auto sa_iter = priv.cache_hash_map.find(item);
-    if (sa_iter == priv.cache_hash_map.end()) { return false; }
-    a = sa_iter->second.a;
-    a_cost = sa_iter->second.s;
+    const scored_action* sa = priv.cache_hash_map.find(priv.cache_key.data(), key_size);
+    if (sa == nullptr) { return false; }
+    a = sa->a;
+    a_cost = sa->s;
     return a != static_cast<action>(-1);
   }
 }
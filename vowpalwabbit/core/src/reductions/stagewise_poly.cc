@@ -63,6 +63,12 @@ public:
   uint64_t num_examples_sync = 0;
 
   VW::example synth_ec;
+  // Expansion plan of the current example: its features with masked, un-offset weight indices, built by one pass
+  // over the example (interactions included) and walked at every level of the dfs.  Reused between examples.
+  VW::features atomics;
+  // Number of parent bits set in depthsbits.  Kept up to date by parent_toggle() and recounted when depthsbits is
+  // replaced wholesale (all_reduce, model load).  While it is zero no feature can be expanded.
+  uint64_t support_size = 0;
   // following is bookkeeping in synth_ec creation (dfs)
   VW::feature synth_rec_f{0.f, 0};
   VW::example* original_ec = nullptr;
@@ -157,7 +163,19 @@ inline void parent_toggle(stagewise_poly& poly, uint64_t wid)
 {
   assert(wid % stride_shift(poly, 1) == 0);
   assert(do_ft_offset(poly, wid) % stride_shift(poly, 1) == 0);
-  poly.depthsbits[wid_mask_un_shifted(poly, do_ft_offset(poly, wid)) * 2 + 1] ^= PARENT_BIT;
+  uint8_t& bits = poly.depthsbits[wid_mask_un_shifted(poly, do_ft_offset(poly, wid)) * 2 + 1];
+  bits ^= PARENT_BIT;
+  if (bits & PARENT_BIT) { ++poly.support_size; }
+  else { --poly.support_size; }
+}
+
+void support_size_recount(stagewise_poly& poly)
+{
+  poly.support_size = 0;
+  for (uint64_t i = 0; i < poly.all->length(); ++i)
+  {
+    if (poly.depthsbits[i * 2 + 1] & PARENT_BIT) { ++poly.support_size; }
+  }
 }
 
 inline bool cycle_get(const stagewise_poly& poly, uint64_t wid)
@@ -422,10 +440,16 @@ void synthetic_decycle(stagewise_poly& poly)
   }
 }
 
-void synthetic_create_rec(stagewise_poly& poly, float v, uint64_t findex)
+void synthetic_plan_add(stagewise_poly& poly, float v, uint64_t findex)
 {
   // Note: need to un_ft_shift since gd::foreach_feature bakes in the offset.
-  uint64_t wid_atomic = wid_mask(poly, un_ft_offset(poly, findex));
+  poly.atomics.push_back(v, wid_mask(poly, un_ft_offset(poly, findex)));
+}
+
+void synthetic_expand(stagewise_poly& poly);
+
+void synthetic_create_rec(stagewise_poly& poly, float v, uint64_t wid_atomic)
+{
   uint64_t wid_cur = child_wid(poly, wid_atomic, poly.synth_rec_f.weight_index);
   assert(wid_atomic % stride_shift(poly, 1) == 0);
 
@@ -462,7 +486,7 @@ void synthetic_create_rec(stagewise_poly& poly, float v, uint64_t findex)
     poly.synth_ec.feature_space[TREE_ATOMICS].push_back(temp.x, temp.weight_index);
     poly.synth_ec.num_features++;
 
-    if (parent_get(poly, temp.weight_index))
+    if (poly.support_size != 0 && parent_get(poly, temp.weight_index))
     {
       VW::feature parent_f = poly.synth_rec_f;
       poly.synth_rec_f = temp;
@@ -470,17 +494,26 @@ void synthetic_create_rec(stagewise_poly& poly, float v, uint64_t findex)
 #ifdef DEBUG
       poly.max_depth = (poly.max_depth > poly.cur_depth) ? poly.max_depth : poly.cur_depth;
 #endif  // DEBUG
-      VW::foreach_feature<stagewise_poly, uint64_t, synthetic_create_rec>(*(poly.all), *(poly.original_ec), poly);
+      synthetic_expand(poly);
       --poly.cur_depth;
       poly.synth_rec_f = parent_f;
     }
   }
 }
 
+void synthetic_expand(stagewise_poly& poly)
+{
+  const VW::features& atomics = poly.atomics;
+  for (size_t i = 0; i < atomics.size(); ++i) { synthetic_create_rec(poly, atomics.values[i], atomics.indices[i]); }
+}
+
 void synthetic_create(stagewise_poly& poly, VW::example& ec, bool training)
 {
   synthetic_reset(poly, ec);
 
+  poly.atomics.clear();
+  VW::foreach_feature<stagewise_poly, uint64_t, synthetic_plan_add>(*poly.all, *poly.original_ec, poly);
+
   poly.cur_depth = 0;
 
   poly.synth_rec_f.x = 1.0;
@@ -491,7 +524,7 @@ void synthetic_create(stagewise_poly& poly, VW::example& ec, bool training)
    * parent, and recurse just on that feature (which arguably correctly interprets poly.cur_depth).
    * Problem with this is if there is a collision with the root...
    */
-  VW::foreach_feature<stagewise_poly, uint64_t, synthetic_create_rec>(*poly.all, *poly.original_ec, poly);
+  synthetic_expand(poly);
   synthetic_decycle(poly);
 
   if (training)
@@ -594,6 +627,7 @@ void end_pass(stagewise_poly& poly)
      * case...
      */
     VW::details::all_reduce<uint8_t, reduce_min_max>(all, poly.depthsbits, depthsbits_sizeof(poly));
+    support_size_recount(poly);
 
     sum_input_sparsity_inc =
         static_cast<uint64_t>(VW::details::accumulate_scalar(all, static_cast<float>(sum_input_sparsity_inc)));
@@ -627,6 +661,7 @@ void save_load(stagewise_poly& poly, VW::io_buf& model_file, bool read, bool tex
     std::stringstream msg;
     VW::details::bin_text_read_write_fixed(model_file, reinterpret_cast<char*>(poly.depthsbits),
         static_cast<uint32_t>(depthsbits_sizeof(poly)), read, msg, text);
+    if (read) { support_size_recount(poly); }
   }
   // unfortunately, following can't go here since save_load called before gd::save_load and thus
   // weight vector state uninitialiazed.
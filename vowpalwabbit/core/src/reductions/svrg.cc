@@ -62,19 +62,43 @@ inline float inline_predict(VW::workspace& all, VW::example& ec)
   return acc;
 }
 
-// -- Prediction, using inner vs. stable weights --
+// Learning needs the predictions of both the inner and the stable weights, they
+// are accumulated in the same pass over the features.
 
-float predict_stable(const svrg& s, VW::example& ec)
+class predictions
 {
-  return VW::details::finalize_prediction(*s.all->sd, s.all->logger, inline_predict<W_STABLE>(*s.all, ec));
+public:
+  float inner;
+  float stable;
+};
+
+inline void vec_add_inner_and_stable(predictions& p, const float x, float& w)
+{
+  float* ws = &w;
+  p.inner += x * ws[W_INNER];
+  p.stable += x * ws[W_STABLE];
 }
 
+// -- Prediction, using inner vs. stable weights --
+
 void predict(svrg& s, VW::example& ec)
 {
   ec.partial_prediction = inline_predict<W_INNER>(*s.all, ec);
   ec.pred.scalar = VW::details::finalize_prediction(*s.all->sd, s.all->logger, ec.partial_prediction);
 }
 
+// Sets the prediction of |ec| according to the inner weights and returns the one
+// according to the stable weights.
+float predict_inner_and_stable(svrg& s, VW::example& ec)
+{
+  const auto& simple_red_features = ec.ex_reduction_features.template get<VW::simple_label_reduction_features>();
+  predictions p{simple_red_features.initial, simple_red_features.initial};
+  VW::foreach_feature<predictions, vec_add_inner_and_stable>(*s.all, ec, p);
+  ec.partial_prediction = p.inner;
+  ec.pred.scalar = VW::details::finalize_prediction(*s.all->sd, s.all->logger, ec.partial_prediction);
+  return VW::details::finalize_prediction(*s.all->sd, s.all->logger, p.stable);
+}
+
 float gradient_scalar(const svrg& s, const VW::example& ec, float pred)
 {
   return s.all->loss_config.loss->first_derivative(s.all->sd.get(), pred, ec.l.simple.label) * ec.weight;
@@ -103,27 +127,25 @@ inline void update_stable_feature(float& g_scalar, float x, float& w)
   ws[W_STABLEGRAD] += g_scalar * x;
 }
 
-void update_inner(const svrg& s, VW::example& ec)
+void update_inner(const svrg& s, VW::example& ec, float stable_pred)
 {
   update u;
   // |ec| already has prediction according to inner weights.
   u.g_scalar_inner = gradient_scalar(s, ec, ec.pred.scalar);
-  u.g_scalar_stable = gradient_scalar(s, ec, predict_stable(s, ec));
+  u.g_scalar_stable = gradient_scalar(s, ec, stable_pred);
   u.eta = s.all->update_rule_config.eta;
   u.norm = static_cast<float>(s.stable_grad_count);
   VW::foreach_feature<update, update_inner_feature>(*s.all, ec, u);
 }
 
-void update_stable(const svrg& s, VW::example& ec)
+void update_stable(const svrg& s, VW::example& ec, float stable_pred)
 {
-  float g = gradient_scalar(s, ec, predict_stable(s, ec));
+  float g = gradient_scalar(s, ec, stable_pred);
   VW::foreach_feature<float, update_stable_feature>(*s.all, ec, g);
 }
 
 void learn(svrg& s, VW::example& ec)
 {
-  predict(s, ec);
-
   const int pass = static_cast<int>(s.all->runtime_state.passes_complete);
 
   if (pass % (s.stage_size + 1) == 0)  // Compute exact gradient
@@ -140,7 +162,8 @@ void learn(svrg& s, VW::example& ec)
       s.stable_grad_count = 0;
       *(s.all->output_runtime.trace_message) << "svrg pass " << pass << ": computing exact gradient" << std::endl;
     }
-    update_stable(s, ec);
+    // The stable prediction is only taken once the stable point of this stage is committed.
+    update_stable(s, ec, predict_inner_and_stable(s, ec));
     s.stable_grad_count++;
   }
   else  // Perform updates
@@ -149,7 +172,7 @@ void learn(svrg& s, VW::example& ec)
     {
       *(s.all->output_runtime.trace_message) << "svrg pass " << pass << ": taking steps" << std::endl;
     }
-    update_inner(s, ec);
+    update_inner(s, ec, predict_inner_and_stable(s, ec));
   }
 
   s.prev_pass = pass;
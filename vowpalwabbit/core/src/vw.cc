@@ -983,18 +983,7 @@ void VW::copy_example_metadata(example* dst, const example* src)
 
 void VW::copy_example_data(example* dst, const example* src)
 {
-  copy_example_metadata(dst, src);
-
-  // copy feature data
-  dst->indices = src->indices;
-  for (namespace_index c : src->indices) { dst->feature_space[c] = src->feature_space[c]; }
-  dst->num_features = src->num_features;
-  dst->total_sum_feat_sq = src->total_sum_feat_sq;
-  dst->_total_sum_feat_sq_calculated = src->_total_sum_feat_sq_calculated;
-  dst->_use_permutations = src->_use_permutations;
-  dst->interactions = src->interactions;
-  dst->extent_interactions = src->extent_interactions;
-  dst->debug_current_reduction_depth = src->debug_current_reduction_depth;
+  copy_example_data_with_index_map(dst, src, [](feature_index index) { return index; });
 }
 
 void VW::copy_example_data_with_label(example* dst, const example* src)
@@ -0,0 +1,75 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/learner.h"
+#include "vw/core/multi_model_utils.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+std::string example_text(int i)
+{
+  return std::to_string(i % 2) + " |a x" + std::to_string(i % 5) + " y:0.5 |b u" + std::to_string(i % 3) + " v" +
+      std::to_string(i % 7);
+}
+
+// Predicts every bootstrap round of an unlabeled example on its own, then as one fused pass, and expects the same
+// scores.
+void check_fused_rounds_match(VW::workspace& vw, size_t rounds, bool expect_fused)
+{
+  for (int i = 0; i < 40; i++)
+  {
+    auto* ex = VW::read_example(vw, example_text(i));
+    vw.learn(*ex);
+    vw.finish_example(*ex);
+  }
+
+  auto* scorer = vw.l->get_learner_by_name_prefix("scorer");
+  VW::multi_model::fused_pass_state fused_passes;
+  fused_passes.can_fuse = VW::reductions::multi_model::can_fuse_models(*scorer);
+  EXPECT_EQ(fused_passes.can_fuse, expect_fused);
+
+  for (int i = 0; i < 5; i++)
+  {
+    auto* ex = VW::read_example(vw, "|a x" + std::to_string(i) + " y:0.5 |b u" + std::to_string(i) + " v1");
+
+    std::vector<float> expected;
+    for (size_t round = 0; round < rounds; round++)
+    {
+      scorer->predict(*ex, round);
+      expected.push_back(ex->pred.scalar);
+    }
+
+    VW::reductions::multi_model::begin_fused_pass(*ex, *scorer, rounds, fused_passes);
+    for (size_t round = 0; round < rounds; round++)
+    {
+      scorer->predict(*ex, round);
+      EXPECT_EQ(ex->pred.scalar, expected[round]);
+    }
+    VW::reductions::multi_model::end_fused_pass(*ex);
+
+    vw.finish_example(*ex);
+  }
+}
+}  // namespace
+
+TEST(Bs, FusedRoundPredictionsMatchPerRoundPredictions)
+{
+  auto vw = VW::initialize(vwtest::make_args("--bootstrap", "4", "-q", "ab", "--quiet"));
+  check_fused_rounds_match(*vw, 4, true);
+}
+
+TEST(Bs, LrqRoundPredictionsAreNotFused)
+{
+  // lrq derives features from the weights of the round it predicts, so the rounds must not be predicted together.
+  auto vw = VW::initialize(vwtest::make_args("--bootstrap", "4", "--lrq", "ab4", "--quiet"));
+  check_fused_rounds_match(*vw, 4, false);
+}
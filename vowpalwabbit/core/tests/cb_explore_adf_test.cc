@@ -2,12 +2,17 @@
 // individual contributors. All rights reserved. Released under a BSD (revised)
 // license as described in the file LICENSE.
 
+#include "vw/core/learner.h"
+#include "vw/core/multi_model_utils.h"
 #include "vw/core/vw.h"
 #include "vw/test_common/test_common.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 TEST(CbExploreAdf, ShouldThrowEmptyMultiExample)
 {
   auto vw = VW::initialize(vwtest::make_args("--cb_explore_adf", "--quiet"));
@@ -16,3 +21,114 @@ TEST(CbExploreAdf, ShouldThrowEmptyMultiExample)
   // An empty example collection is invalid and so should throw.
   EXPECT_THROW(vw->learn(example_collection), VW::vw_exception);
 }
+
+TEST(CbExploreAdf, BagFusedPredictionsMatchPerModelPredictions)
+{
+  auto vw = VW::initialize(vwtest::make_args("--cb_explore_adf", "--bag", "3", "-q", "::", "--quiet"));
+
+  auto make_examples = [&vw](int i, bool labelled)
+  {
+    VW::multi_ex examples;
+    examples.push_back(VW::read_example(*vw, "shared | s" + std::to_string(i % 5) + " t:" + std::to_string(i % 3)));
+    for (int action = 0; action < 3; action++)
+    {
+      std::string line = "| a" + std::to_string(action) + " b" + std::to_string((i + action) % 4);
+      if (labelled && action == i % 3) { line = std::to_string(action) + ":" + std::to_string(i % 2) + ":0.5 " + line; }
+      examples.push_back(VW::read_example(*vw, line));
+    }
+    return examples;
+  };
+
+  for (int i = 0; i < 30; i++)
+  {
+    auto examples = make_examples(i, true);
+    vw->learn(examples);
+    vw->finish_example(examples);
+  }
+
+  auto* cb_adf = require_multiline(vw->l->get_learner_by_name_prefix("cb_adf"));
+  VW::multi_model::fused_pass_state fused_passes;
+  fused_passes.can_fuse = VW::reductions::multi_model::can_fuse_models(*cb_adf);
+  EXPECT_TRUE(fused_passes.can_fuse);
+  auto examples = make_examples(7, false);
+
+  std::vector<VW::action_scores> expected;
+  for (size_t model = 0; model < 3; model++)
+  {
+    cb_adf->predict(examples, model);
+    expected.push_back(examples[0]->pred.a_s);
+  }
+
+  VW::reductions::multi_model::begin_fused_pass(examples, *cb_adf, 3, fused_passes);
+  for (size_t model = 0; model < 3; model++)
+  {
+    cb_adf->predict(examples, model);
+    const auto& actual = examples[0]->pred.a_s;
+    ASSERT_EQ(actual.size(), expected[model].size());
+    for (size_t a = 0; a < actual.size(); a++)
+    {
+      EXPECT_EQ(actual[a].action, expected[model][a].action);
+      EXPECT_EQ(actual[a].score, expected[model][a].score);
+    }
+  }
+  VW::reductions::multi_model::end_fused_pass(examples);
+
+  vw->finish_example(examples);
+}
+
+TEST(CbExploreAdf, BagWithLrqMatchesPerModelPredictions)
+{
+  // lrq derives features from the weights of the model it predicts, so the models must not be predicted together.
+  auto vw = VW::initialize(vwtest::make_args("--cb_explore_adf", "--bag", "3", "--lrq", "ab4", "--quiet"));
+
+  auto make_examples = [&vw](int i, bool labelled)
+  {
+    VW::multi_ex examples;
+    examples.push_back(VW::read_example(*vw, "shared |a s" + std::to_string(i % 5) + " t:" + std::to_string(i % 3)));
+    for (int action = 0; action < 3; action++)
+    {
+      // Both namespaces of the pair are on the action itself, the shared example is only merged in above cb_adf.
+      std::string line = "|a c" + std::to_string((i + action) % 3) + " |b a" + std::to_string(action) + " b" +
+          std::to_string((i + action) % 4);
+      if (labelled && action == i % 3) { line = std::to_string(action) + ":" + std::to_string(i % 2) + ":0.5 " + line; }
+      examples.push_back(VW::read_example(*vw, line));
+    }
+    return examples;
+  };
+
+  for (int i = 0; i < 30; i++)
+  {
+    auto examples = make_examples(i, true);
+    vw->learn(examples);
+    vw->finish_example(examples);
+  }
+
+  auto* cb_adf = require_multiline(vw->l->get_learner_by_name_prefix("cb_adf"));
+  VW::multi_model::fused_pass_state fused_passes;
+  fused_passes.can_fuse = VW::reductions::multi_model::can_fuse_models(*cb_adf);
+  EXPECT_FALSE(fused_passes.can_fuse);
+  auto examples = make_examples(7, false);
+
+  std::vector<VW::action_scores> expected;
+  for (size_t model = 0; model < 3; model++)
+  {
+    cb_adf->predict(examples, model);
+    expected.push_back(examples[0]->pred.a_s);
+  }
+
+  VW::reductions::multi_model::begin_fused_pass(examples, *cb_adf, 3, fused_passes);
+  for (size_t model = 0; model < 3; model++)
+  {
+    cb_adf->predict(examples, model);
+    const auto& actual = examples[0]->pred.a_s;
+    ASSERT_EQ(actual.size(), expected[model].size());
+    for (size_t a = 0; a < actual.size(); a++)
+    {
+      EXPECT_EQ(actual[a].action, expected[model][a].action);
+      EXPECT_EQ(actual[a].score, expected[model][a].score);
+    }
+  }
+  VW::reductions::multi_model::end_fused_pass(examples);
+
+  vw->finish_example(examples);
+}
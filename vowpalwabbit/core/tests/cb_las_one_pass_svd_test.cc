@@ -287,6 +287,80 @@ TEST(Las, CheckActionCacheWithCB)
   EXPECT_TRUE(U_wnocache.isApprox(U_wcache, vwtest::EXPLICIT_FLOAT_TOL));
 }
 
+TEST(Las, CheckActionCacheOnlyComputesNewActions)
+{
+  auto d = 3;
+  Eigen::MatrixXf AOmega_wcache;
+  Eigen::MatrixXf AOmega_wnocache;
+
+  for (const int cache_slack : {50, -1})
+  {
+    std::vector<std::string> args{"--cb_explore_adf", "--large_action_space", "--max_actions", std::to_string(d),
+        "--quiet", "--action_cache_slack", std::to_string(cache_slack)};
+    auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+
+    VW::LEARNER::learner* learner =
+        require_multiline(vw->l->get_learner_by_name_prefix("cb_explore_adf_large_action_space"));
+    auto* action_space = (internal_action_space_op*)learner->get_internal_type_erased_data_pointer_test_use_only();
+    EXPECT_EQ(action_space != nullptr, true);
+
+    {
+      VW::multi_ex examples;
+
+      examples.push_back(VW::read_example(*vw, "shared |U b c"));
+      examples.push_back(VW::read_example(*vw, "| 1:0.1 2:0.12 3:0.13 b200:2 c500:9"));
+      examples.push_back(VW::read_example(*vw, "| a_1:0.5 a_2:0.65 a_3:0.12 a100:4 a200:33"));
+      examples.push_back(VW::read_example(*vw, "| a_1:0.8 a_2:0.32 a_3:0.15 a100:0.2 a200:0.2"));
+      examples.push_back(VW::read_example(*vw, "| a_1:2.1 a_2:1.29 a_3:0.42 a100:4.4 a200:33.4"));
+      examples.push_back(VW::read_example(*vw, "| a_4:0.8 a_5:0.32 a_6:0.15 d1:0.2 d10: 0.2"));
+      examples.push_back(VW::read_example(*vw, "| a_7 a_8 a_9 v1:0.99"));
+      examples.push_back(VW::read_example(*vw, "| a_10 a_11 a_12"));
+      examples.push_back(VW::read_example(*vw, "| a_13 a_14 a_15"));
+      examples.push_back(VW::read_example(*vw, "| a_16 a_17 a_18:0.2"));
+      examples.push_back(VW::read_example(*vw, "| a_19 a_20 a_18:0.2"));
+      examples.push_back(VW::read_example(*vw, "| a_21 a_22 a_18:0.2"));
+      examples.push_back(VW::read_example(*vw, "| a_23 a_24 a_18:0.2"));
+      examples.push_back(VW::read_example(*vw, "| a_25 a_26 a_18:0.2"));
+      examples.push_back(VW::read_example(*vw, "| a_27 a_28 a_18:0.2"));
+
+      vw->predict(examples);
+      vw->finish_example(examples);
+    }
+
+    // a request that drops some of the actions and adds a new one keeps the rows of the actions already seen
+    {
+      VW::multi_ex examples;
+
+      examples.push_back(VW::read_example(*vw, "shared |A a b"));
+      examples.push_back(VW::read_example(*vw, "| a_29 a_30 a_18:0.4"));
+      examples.push_back(VW::read_example(*vw, "| a_7 a_8 a_9 v1:0.99"));
+      examples.push_back(VW::read_example(*vw, "| a_10 a_11 a_12"));
+      examples.push_back(VW::read_example(*vw, "| a_13 a_14 a_15"));
+      examples.push_back(VW::read_example(*vw, "| a_16 a_17 a_18:0.2"));
+      examples.push_back(VW::read_example(*vw, "| a_19 a_20 a_18:0.2"));
+      examples.push_back(VW::read_example(*vw, "| a_21 a_22 a_18:0.2"));
+      examples.push_back(VW::read_example(*vw, "| a_23 a_24 a_18:0.2"));
+      examples.push_back(VW::read_example(*vw, "| a_25 a_26 a_18:0.2"));
+      examples.push_back(VW::read_example(*vw, "| a_27 a_28 a_18:0.2"));
+      examples.push_back(VW::read_example(*vw, "| a_1:0.5 a_2:0.65 a_3:0.12 a100:4 a200:33"));
+      examples.push_back(VW::read_example(*vw, "| a_1:0.8 a_2:0.32 a_3:0.15 a100:0.2 a200:0.2"));
+      examples.push_back(VW::read_example(*vw, "| a_1:2.1 a_2:1.29 a_3:0.42 a100:4.4 a200:33.4"));
+
+      vw->predict(examples);
+      if (cache_slack == 50)
+      {
+        EXPECT_EQ(action_space->explore.impl.cached_example_hashes.size(), 15);
+        AOmega_wcache = action_space->explore.impl.AOmega;
+      }
+      else if (cache_slack == -1) { AOmega_wnocache = action_space->explore.impl.AOmega; }
+
+      vw->finish_example(examples);
+    }
+  }
+
+  EXPECT_TRUE(AOmega_wnocache == AOmega_wcache);
+}
+
 TEST(Las, CheckActionCacheWithCCB)
 {
   auto d = 3;
@@ -11,6 +11,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <string>
 #include <vector>
 
 TEST(Ccb, ExplicitIncludedActionsNoOverlap)
@@ -200,4 +201,126 @@ TEST(Ccb, NoAvailableActions)
 
     vw->finish_example(examples);
   }
-}
\ No newline at end of file
+}
+
+TEST(Ccb, SlotInvariantPredictionsMatchPerSlotPredictions)
+{
+  // Sparse weights always predict every slot from scratch, dense weights reuse what does not depend on the slot.
+  auto dense = VW::initialize(vwtest::make_args(
+      "--ccb_explore_adf", "--softmax", "--lambda", "10", "-q", "UA", "-q", "SA", "--quiet", "--random_seed", "5"));
+  auto sparse = VW::initialize(vwtest::make_args("--ccb_explore_adf", "--softmax", "--lambda", "10", "-q", "UA", "-q",
+      "SA", "--quiet", "--random_seed", "5", "--sparse_weights"));
+
+  auto make_examples = [](VW::workspace& vw, int i, bool labelled)
+  {
+    VW::multi_ex examples;
+    examples.push_back(VW::read_example(vw, "ccb shared |User u" + std::to_string(i % 4) + " v:0.5 |Ctx c"));
+    for (int action = 0; action < 5; action++)
+    {
+      examples.push_back(VW::read_example(
+          vw, "ccb action |Action a" + std::to_string(action) + " b" + std::to_string((action + i) % 3)));
+    }
+    for (int slot = 0; slot < 3; slot++)
+    {
+      const std::string label =
+          labelled ? std::to_string((i + slot) % 5) + ":" + std::to_string((i + slot) % 2) + ":0.5 " : "";
+      examples.push_back(VW::read_example(vw, "ccb slot " + label + "|Slot s" + std::to_string(slot)));
+    }
+    return examples;
+  };
+
+  for (auto* vw : {dense.get(), sparse.get()})
+  {
+    for (int i = 0; i < 20; i++)
+    {
+      auto examples = make_examples(*vw, i, true);
+      vw->learn(examples);
+      vw->finish_example(examples);
+    }
+  }
+
+  auto dense_examples = make_examples(*dense, 3, false);
+  auto sparse_examples = make_examples(*sparse, 3, false);
+  dense->predict(dense_examples);
+  sparse->predict(sparse_examples);
+
+  const auto& dense_scores = dense_examples[0]->pred.decision_scores;
+  const auto& sparse_scores = sparse_examples[0]->pred.decision_scores;
+  ASSERT_EQ(dense_scores.size(), 3);
+  ASSERT_EQ(sparse_scores.size(), 3);
+  for (size_t slot = 0; slot < dense_scores.size(); slot++)
+  {
+    ASSERT_EQ(dense_scores[slot].size(), sparse_scores[slot].size());
+    for (size_t a = 0; a < dense_scores[slot].size(); a++)
+    {
+      EXPECT_EQ(dense_scores[slot][a].action, sparse_scores[slot][a].action);
+      EXPECT_NEAR(dense_scores[slot][a].score, sparse_scores[slot][a].score, 1e-5);
+    }
+  }
+
+  dense->finish_example(dense_examples);
+  sparse->finish_example(sparse_examples);
+}
+
+TEST(Ccb, LrqOnSlotNamespacePredictionsMatchPerSlotPredictions)
+{
+  // lrq adds features to the Action namespace which depend on the Slot namespace, so nothing of a prediction can be
+  // reused across the slots of a decision.
+  auto dense = VW::initialize(vwtest::make_args(
+      "--ccb_explore_adf", "--softmax", "--lambda", "3", "--lrq", "SA4", "--quiet", "--random_seed", "5"));
+  auto sparse = VW::initialize(vwtest::make_args("--ccb_explore_adf", "--softmax", "--lambda", "3", "--lrq", "SA4",
+      "--quiet", "--random_seed", "5", "--sparse_weights"));
+
+  auto make_examples = [](VW::workspace& vw, int i, bool labelled)
+  {
+    VW::multi_ex examples;
+    examples.push_back(VW::read_example(vw, "ccb shared |User u" + std::to_string(i % 4)));
+    for (int action = 0; action < 4; action++)
+    {
+      examples.push_back(VW::read_example(
+          vw, "ccb action |Action a" + std::to_string(action) + " b" + std::to_string((action + i) % 3)));
+    }
+    for (int slot = 0; slot < 3; slot++)
+    {
+      const std::string label =
+          labelled ? std::to_string((i + slot) % 4) + ":" + std::to_string((i + slot) % 2) + ":0.5 " : "";
+      examples.push_back(VW::read_example(vw, "ccb slot " + label + "|Slot s" + std::to_string(slot) + " t:0.5"));
+    }
+    return examples;
+  };
+
+  for (auto* vw : {dense.get(), sparse.get()})
+  {
+    for (int i = 0; i < 50; i++)
+    {
+      auto examples = make_examples(*vw, i, true);
+      vw->learn(examples);
+      vw->finish_example(examples);
+    }
+  }
+
+  for (int i = 0; i < 4; i++)
+  {
+    auto dense_examples = make_examples(*dense, i, false);
+    auto sparse_examples = make_examples(*sparse, i, false);
+    dense->predict(dense_examples);
+    sparse->predict(sparse_examples);
+
+    const auto& dense_scores = dense_examples[0]->pred.decision_scores;
+    const auto& sparse_scores = sparse_examples[0]->pred.decision_scores;
+    ASSERT_EQ(dense_scores.size(), 3);
+    ASSERT_EQ(sparse_scores.size(), 3);
+    for (size_t slot = 0; slot < dense_scores.size(); slot++)
+    {
+      ASSERT_EQ(dense_scores[slot].size(), sparse_scores[slot].size());
+      for (size_t a = 0; a < dense_scores[slot].size(); a++)
+      {
+        EXPECT_EQ(dense_scores[slot][a].action, sparse_scores[slot][a].action);
+        EXPECT_NEAR(dense_scores[slot][a].score, sparse_scores[slot][a].score, 1e-5);
+      }
+    }
+
+    dense->finish_example(dense_examples);
+    sparse->finish_example(sparse_examples);
+  }
+}
@@ -0,0 +1,144 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/delta_checkpoint.h"
+
+#include "vw/core/example.h"
+#include "vw/core/global_data.h"
+#include "vw/core/io_buf.h"
+#include "vw/core/shared_data.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t BLOCK_SIZE = 64;
+
+void learn_examples(VW::workspace& all, int first, int count)
+{
+  for (int i = first; i < first + count; i++)
+  {
+    auto* ex = VW::read_example(
+        all, std::to_string(i % 2) + " | a:" + std::to_string(i % 7) + " b" + std::to_string(i % 13) + " c");
+    all.learn(*ex);
+    all.finish_example(*ex);
+  }
+}
+
+std::unique_ptr<VW::io::reader> read_from(const std::shared_ptr<std::vector<char>>& buffer)
+{
+  return VW::io::create_buffer_view(buffer->data(), buffer->size());
+}
+
+void expect_same_weights(VW::workspace& expected, VW::workspace& actual)
+{
+  auto& expected_weights = expected.weights.dense_weights;
+  auto& actual_weights = actual.weights.dense_weights;
+  ASSERT_EQ(expected_weights.raw_length(), actual_weights.raw_length());
+  const VW::weight* expected_data = expected_weights.first();
+  const VW::weight* actual_data = actual_weights.first();
+  for (size_t i = 0; i < expected_weights.raw_length(); i++) { EXPECT_FLOAT_EQ(expected_data[i], actual_data[i]) << i; }
+  EXPECT_EQ(expected.sd->example_number, actual.sd->example_number);
+}
+
+float predict(VW::workspace& all, const std::string& line)
+{
+  auto* ex = VW::read_example(all, line);
+  all.predict(*ex);
+  const float prediction = ex->pred.scalar;
+  all.finish_example(*ex);
+  return prediction;
+}
+
+std::unique_ptr<VW::workspace> replay(const std::shared_ptr<std::vector<char>>& log)
+{
+  auto state = std::make_shared<std::vector<char>>(VW::read_delta_checkpoint_state(read_from(log)));
+  auto replayed = VW::initialize(vwtest::make_args("--quiet", "--preserve_performance_counters"), read_from(state));
+  VW::apply_delta_checkpoints(*replayed, read_from(log));
+  return replayed;
+}
+}  // namespace
+
+TEST(DeltaCheckpoint, ReplayMatchesLiveModel)
+{
+  auto live = VW::initialize(vwtest::make_args("--quiet", "-b", "10"));
+  auto log = std::make_shared<std::vector<char>>();
+  VW::delta_checkpoint_writer writer(*live, VW::io::create_vector_writer(log), false, BLOCK_SIZE);
+
+  learn_examples(*live, 0, 50);
+  writer.checkpoint();
+  learn_examples(*live, 50, 50);
+  writer.checkpoint();
+
+  // Only a handful of features are active, so a delta touches few blocks.
+  learn_examples(*live, 100, 1);
+  writer.checkpoint();
+  EXPECT_GT(writer.blocks_in_last_checkpoint(), 0);
+  EXPECT_LT(writer.blocks_in_last_checkpoint(), live->weights.dense_weights.raw_length() / BLOCK_SIZE);
+  EXPECT_EQ(writer.checkpoints_written(), 3);
+
+  auto replayed = replay(log);
+  expect_same_weights(*live, *replayed);
+  EXPECT_FLOAT_EQ(predict(*live, "| a:3 b5 c"), predict(*replayed, "| a:3 b5 c"));
+}
+
+TEST(DeltaCheckpoint, CompactionIsEquivalent)
+{
+  auto live = VW::initialize(vwtest::make_args("--quiet", "-b", "10"));
+  auto log = std::make_shared<std::vector<char>>();
+  VW::delta_checkpoint_writer writer(*live, VW::io::create_vector_writer(log), false, BLOCK_SIZE);
+  for (int i = 0; i < 5; i++)
+  {
+    learn_examples(*live, i * 20, 20);
+    writer.checkpoint();
+  }
+
+  auto compacted = std::make_shared<std::vector<char>>();
+  VW::compact_delta_checkpoints(read_from(log), VW::io::create_vector_writer(compacted));
+  EXPECT_LT(compacted->size(), log->size());
+
+  auto replayed = replay(compacted);
+  expect_same_weights(*live, *replayed);
+}
+
+TEST(DeltaCheckpoint, DeltasApplyOntoBaseModel)
+{
+  auto live = VW::initialize(vwtest::make_args("--quiet", "-b", "10"));
+  learn_examples(*live, 0, 30);
+
+  auto base_model = std::make_shared<std::vector<char>>();
+  {
+    VW::io_buf model_writer;
+    model_writer.add_file(VW::io::create_vector_writer(base_model));
+    VW::save_predictor(*live, model_writer);
+  }
+
+  auto log = std::make_shared<std::vector<char>>();
+  VW::delta_checkpoint_writer writer(*live, VW::io::create_vector_writer(log), true, BLOCK_SIZE);
+  learn_examples(*live, 30, 30);
+  writer.checkpoint();
+
+  auto replayed =
+      VW::initialize(vwtest::make_args("--quiet", "--preserve_performance_counters"), read_from(base_model));
+  VW::apply_delta_checkpoints(*replayed, read_from(log));
+  expect_same_weights(*live, *replayed);
+}
+
+TEST(DeltaCheckpoint, RejectsMismatchedModel)
+{
+  auto live = VW::initialize(vwtest::make_args("--quiet", "-b", "10"));
+  auto log = std::make_shared<std::vector<char>>();
+  VW::delta_checkpoint_writer writer(*live, VW::io::create_vector_writer(log), false, BLOCK_SIZE);
+  learn_examples(*live, 0, 10);
+  writer.checkpoint();
+
+  auto other = VW::initialize(vwtest::make_args("--quiet", "-b", "12"));
+  EXPECT_THROW(VW::apply_delta_checkpoints(*other, read_from(log)), VW::vw_exception);
+}
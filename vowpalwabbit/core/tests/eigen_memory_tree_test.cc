@@ -131,6 +131,48 @@ TEST(EigenMemoryTree, ExactMatchWithRouterTest)
   }
 }
 
+TEST(EigenMemoryTree, ExactMatchWithCandidatesTest)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "--emt", "--emt_candidates", "3"));
+  auto* tree = get_emt_tree(*vw);
+
+  for (int i = 0; i < 20; i++)
+  {
+    auto* ex = VW::read_example(*vw, std::to_string(i) + " | " + std::to_string(i) + " c");
+    vw->learn(*ex);
+    vw->finish_example(*ex);
+  }
+
+  EXPECT_EQ(tree->root->examples.size(), 20);
+
+  for (int i = 0; i < 20; i++)
+  {
+    auto* ex = VW::read_example(*vw, " | " + std::to_string(i) + " c");
+    vw->predict(*ex);
+    EXPECT_EQ(ex->pred.multiclass, i);
+    vw->finish_example(*ex);
+  }
+}
+
+TEST(EigenMemoryTree, Sketch)
+{
+  emt_feats v1;
+  v1.emplace_back(1, 1.f);
+  v1.emplace_back(5, -2.f);
+  v1.emplace_back(9, .5f);
+
+  auto v2 = v1;
+  emt_scale(v2, 3);
+
+  emt_feats v3;
+  for (const auto& f : v1) { v3.emplace_back(f.first, -f.second); }
+
+  // the sketch only depends on the direction of the features
+  EXPECT_EQ(emt_sketch(v1), emt_sketch(v2));
+  EXPECT_NE(emt_sketch(v1), emt_sketch(v3));
+  EXPECT_EQ(emt_sketch(emt_feats()), 0);
+}
+
 TEST(EigenMemoryTree, BoundingDrop)
 {
   auto vw = VW::initialize(vwtest::make_args("--quiet", "--emt", "--emt_tree", "5"));
@@ -3,6 +3,7 @@
 // license as described in the file LICENSE.
 
 #include "vw/core/example.h"
+#include "vw/core/vw.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -32,3 +33,37 @@ TEST(Example, MoveAssignOpMovesPred)
   EXPECT_EQ(ex.pred.a_s.size(), 0);
   EXPECT_EQ(ex2.pred.a_s.size(), 1);
 }
+
+TEST(Example, CopyExampleDataWithIndexMapMapsIndicesAndKeepsBuffers)
+{
+  VW::example src;
+  src.indices.push_back('a');
+  for (uint64_t i = 0; i < 16; ++i) { src.feature_space['a'].push_back(static_cast<float>(i), i << 2); }
+  src.num_features = 16;
+
+  VW::example dst;
+  VW::copy_example_data_with_index_map(&dst, &src, [](VW::feature_index idx) { return idx + 1; });
+  ASSERT_EQ(dst.indices.size(), 1);
+  const auto& fs = dst.feature_space['a'];
+  ASSERT_EQ(fs.size(), 16);
+  for (size_t i = 0; i < 16; ++i)
+  {
+    EXPECT_EQ(fs.values[i], static_cast<float>(i));
+    EXPECT_EQ(fs.indices[i], (i << 2) + 1);
+  }
+  EXPECT_EQ(dst.num_features, 16);
+
+  // Refilling from a smaller example reuses the buffers of the first copy.
+  const auto* values = fs.values.begin();
+  const auto* indices = fs.indices.begin();
+  src.feature_space['a'].truncate_to(4);
+  src.num_features = 4;
+  for (int pass = 0; pass < 2000; ++pass)
+  {
+    VW::copy_example_data_with_index_map(&dst, &src, [](VW::feature_index idx) { return idx; });
+  }
+  EXPECT_EQ(fs.size(), 4);
+  EXPECT_EQ(fs.values.begin(), values);
+  EXPECT_EQ(fs.indices.begin(), indices);
+  EXPECT_EQ(dst.num_features, 4);
+}
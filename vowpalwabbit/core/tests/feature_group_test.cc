@@ -156,3 +156,32 @@ TEST(FeatureGroup, IterateExtentsTest)
     EXPECT_EQ(std::distance((*begin).first, (*begin).second), 5);
   }
 }
+
+TEST(FeatureGroup, DotProductMatchesMergeTest)
+{
+  // Runs of indices present on one side only must be skipped, including large ones which need an unsigned compare.
+  const std::vector<uint64_t> indices1 = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 20, 30, 40, 50, 51, 52, 53, 54, 55, 100,
+      0x8000000000000000, 0x8000000000000001, 0xFFFFFFFFFFFFFFF0};
+  const std::vector<uint64_t> indices2 = {
+      0, 5, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 55, 99, 100, 101, 0x8000000000000001, 0xFFFFFFFFFFFFFFF0};
+
+  VW::features fs1;
+  for (size_t i = 0; i < indices1.size(); i++) { fs1.push_back(static_cast<float>(i) + 0.5f, indices1[i]); }
+  VW::features fs2;
+  for (size_t i = 0; i < indices2.size(); i++) { fs2.push_back(2.f * static_cast<float>(i) - 3.f, indices2[i]); }
+
+  float expected = 0.f;
+  for (size_t i = 0; i < indices1.size(); i++)
+  {
+    auto it = std::find(indices2.begin(), indices2.end(), indices1[i]);
+    if (it != indices2.end()) { expected += fs1.values[i] * fs2.values[std::distance(indices2.begin(), it)]; }
+  }
+
+  EXPECT_FLOAT_EQ(VW::features_dot_product(fs1, fs2), expected);
+  EXPECT_FLOAT_EQ(VW::features_dot_product(fs2, fs1), expected);
+  EXPECT_FLOAT_EQ(VW::features_dot_product(fs1, fs1), std::inner_product(fs1.values.begin(), fs1.values.end(),
+                                                          fs1.values.begin(), 0.f));
+  VW::features empty;
+  EXPECT_FLOAT_EQ(VW::features_dot_product(fs1, empty), 0.f);
+  EXPECT_FLOAT_EQ(VW::features_dot_product(empty, fs1), 0.f);
+}
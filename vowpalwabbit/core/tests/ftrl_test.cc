@@ -0,0 +1,80 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/config/options_cli.h"
+#include "vw/core/learner.h"
+#include "vw/core/vw.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+// Numeric feature names of the default namespace are used as their hash, so features 1 to 24 get distinct weights.
+std::string distinct_features_example(size_t i)
+{
+  std::string text = std::to_string(i % 3 == 0 ? 1 : -1) + " |";
+  for (size_t f = 1; f <= 24; f++) { text += " " + std::to_string(f) + ":" + std::to_string((i * f) % 7 / 7.f); }
+  return text;
+}
+
+// With -b 2 there are only four weights, so the features of every block of eight share weights.
+std::string colliding_features_example(size_t i)
+{
+  std::string text = std::to_string(i % 2 == 0 ? 1 : -1) + " |";
+  for (size_t f = 0; f < 20; f++) { text += " f" + std::to_string((f + i) % 9) + ":" + std::to_string(f % 5 / 5.f); }
+  return text;
+}
+
+// Sparse weights always take the per feature path, dense weights the block kernels when they are compiled in.
+void check_dense_matches_sparse(std::vector<std::string> args, std::string (*example_text)(size_t))
+{
+  args.emplace_back("--quiet");
+  auto dense = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  args.emplace_back("--sparse_weights");
+  auto sparse = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+
+  for (size_t i = 0; i < 100; i++)
+  {
+    auto* dense_ex = VW::read_example(*dense, example_text(i));
+    auto* sparse_ex = VW::read_example(*sparse, example_text(i));
+    dense->learn(*dense_ex);
+    sparse->learn(*sparse_ex);
+    EXPECT_FLOAT_EQ(dense_ex->pred.scalar, sparse_ex->pred.scalar);
+    dense->finish_example(*dense_ex);
+    sparse->finish_example(*sparse_ex);
+  }
+
+  auto& dense_weights = dense->weights.dense_weights;
+  auto& sparse_weights = sparse->weights.sparse_weights;
+  const size_t length = static_cast<size_t>(1) << dense->initial_weights_config.num_bits;
+  for (size_t i = 0; i < length; i++)
+  {
+    const float* d = &dense_weights.strided_index(i);
+    const float* s = &sparse_weights.strided_index(i);
+    for (size_t k = 0; k < dense_weights.stride(); k++) { EXPECT_FLOAT_EQ(d[k], s[k]); }
+  }
+}
+}  // namespace
+
+TEST(Ftrl, ProximalDenseMatchesSparse)
+{
+  check_dense_matches_sparse({"--ftrl", "-b", "10"}, distinct_features_example);
+  check_dense_matches_sparse({"--ftrl", "-b", "2"}, colliding_features_example);
+}
+
+TEST(Ftrl, PistolDenseMatchesSparse)
+{
+  check_dense_matches_sparse({"--pistol", "-b", "10"}, distinct_features_example);
+  check_dense_matches_sparse({"--pistol", "-b", "2"}, colliding_features_example);
+}
+
+TEST(Ftrl, CoinBettingDenseMatchesSparse)
+{
+  check_dense_matches_sparse({"--coin", "-b", "10"}, distinct_features_example);
+  check_dense_matches_sparse({"--coin", "-b", "2"}, colliding_features_example);
+}
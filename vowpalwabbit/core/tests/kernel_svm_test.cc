@@ -0,0 +1,56 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/config/options_cli.h"
+#include "vw/core/learner.h"
+#include "vw/core/vw.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+std::string example_text(size_t i)
+{
+  const size_t h = i * 2654435761 % 1000003;
+  // Integer feature names, as in the ksvm data sets: flatten_features() leaves indices unmasked since ksvm has no
+  // weights, and those stay sorted under the parse mask only when they are small.
+  return std::string(h % 2 == 0 ? "1" : "-1") + " |f 1:" + std::to_string(h % 97 / 97.f) +
+      " 2:" + std::to_string(h % 89 / 89.f) + " " + std::to_string(10 + h % 5) + " 3:" + std::to_string(h % 83 / 83.f);
+}
+}  // namespace
+
+TEST(KernelSvm, EvictingKernelRowsKeepsPredictions)
+{
+  // 1MB holds 262144 kernel values, fewer than the rows of 800 support vectors, so rows are evicted and recomputed.
+  std::vector<std::string> args = {"--ksvm", "--kernel", "rbf", "--quiet"};
+  auto cached = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  args.insert(args.end(), {"--ksvm_cache_mb", "1"});
+  auto evicting = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+
+  for (size_t i = 0; i < 800; i++)
+  {
+    auto* cached_ex = VW::read_example(*cached, example_text(i));
+    auto* evicting_ex = VW::read_example(*evicting, example_text(i));
+    cached->learn(*cached_ex);
+    evicting->learn(*evicting_ex);
+    EXPECT_FLOAT_EQ(evicting_ex->pred.scalar, cached_ex->pred.scalar);
+    cached->finish_example(*cached_ex);
+    evicting->finish_example(*evicting_ex);
+  }
+
+  for (size_t i = 0; i < 50; i++)
+  {
+    auto* cached_ex = VW::read_example(*cached, example_text(i + 1000));
+    auto* evicting_ex = VW::read_example(*evicting, example_text(i + 1000));
+    cached->predict(*cached_ex);
+    evicting->predict(*evicting_ex);
+    EXPECT_FLOAT_EQ(evicting_ex->pred.scalar, cached_ex->pred.scalar);
+    cached->finish_example(*cached_ex);
+    evicting->finish_example(*evicting_ex);
+  }
+}
@@ -400,4 +400,71 @@ TEST(Merge, SerializeDeserializeDelta)
       deserialized_delta->unsafe_get_workspace_ptr()->sd->example_number);
   EXPECT_FLOAT_EQ(delta.unsafe_get_workspace_ptr()->sd->total_features,
       deserialized_delta->unsafe_get_workspace_ptr()->sd->total_features);
-}
\ No newline at end of file
+}
+
+TEST(Merge, MergeKeepsBitPrecision)
+{
+  auto vw1 = VW::initialize(vwtest::make_args("--quiet", "-b", "20"));
+  auto vw2 = VW::initialize(vwtest::make_args("--quiet", "-b", "20"));
+
+  for (const auto& text : {"1 | a b", "0 | b c:2"})
+  {
+    auto* ex = VW::read_example(*vw1, text);
+    vw1->learn(*ex);
+    vw1->finish_example(*ex);
+  }
+  for (const auto& text : {"1 | c d", "1 | a d:0.5", "0 | e"})
+  {
+    auto* ex = VW::read_example(*vw2, text);
+    vw2->learn(*ex);
+    vw2->finish_example(*ex);
+  }
+
+  std::vector<const VW::workspace*> workspaces = {vw1.get(), vw2.get()};
+  auto result = VW::merge_models(nullptr, workspaces);
+  ASSERT_EQ(result->initial_weights_config.num_bits, 20);
+
+  // With save_resume each weight is averaged using the adaptive sums of the models as weighting.
+  const size_t length = static_cast<size_t>(1) << result->initial_weights_config.num_bits;
+  const auto& vw1_weights = vw1->weights.dense_weights;
+  const auto& vw2_weights = vw2->weights.dense_weights;
+  const auto& result_weights = result->weights.dense_weights;
+  for (size_t i = 0; i < length; i++)
+  {
+    const float* w1 = &vw1_weights.strided_index(i);
+    const float* w2 = &vw2_weights.strided_index(i);
+    const float total = w1[1] + w2[1];
+    const float expected = total > 0 ? w1[0] * (w1[1] / total) + w2[0] * (w2[1] / total) : 0.f;
+    EXPECT_FLOAT_EQ(result_weights.strided_index(i), expected);
+  }
+}
+
+TEST(Merge, MergeWithThreadsMatchesSerialMerge)
+{
+  // -b 18 gives 16 merge blocks, so every thread merges several of them.
+  auto vw1 = VW::initialize(vwtest::make_args("--quiet", "-b", "18"));
+  auto vw2 = VW::initialize(vwtest::make_args("--quiet", "-b", "18"));
+  for (int i = 0; i < 200; i++)
+  {
+    auto* ex1 = VW::read_example(*vw1, std::to_string(i % 2) + " | a" + std::to_string(i) + " b:0.5");
+    vw1->learn(*ex1);
+    vw1->finish_example(*ex1);
+    auto* ex2 = VW::read_example(*vw2, std::to_string(i % 3 == 0) + " | a" + std::to_string(i * 7) + " c");
+    vw2->learn(*ex2);
+    vw2->finish_example(*ex2);
+  }
+
+  std::vector<const VW::workspace*> workspaces = {vw1.get(), vw2.get()};
+  auto serial = VW::merge_models(nullptr, workspaces);
+  auto threaded = VW::merge_models(nullptr, workspaces, nullptr, 3);
+
+  const auto& serial_weights = serial->weights.dense_weights;
+  const auto& threaded_weights = threaded->weights.dense_weights;
+  const size_t length = static_cast<size_t>(1) << serial->initial_weights_config.num_bits;
+  for (size_t i = 0; i < length; i++)
+  {
+    const float* s = &serial_weights.strided_index(i);
+    const float* t = &threaded_weights.strided_index(i);
+    for (size_t k = 0; k < serial_weights.stride(); k++) { EXPECT_EQ(t[k], s[k]); }
+  }
+}
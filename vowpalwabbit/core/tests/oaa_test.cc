@@ -0,0 +1,76 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/config/options_cli.h"
+#include "vw/core/learner.h"
+#include "vw/core/vw.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+std::string example_text(size_t i) { return "| a" + std::to_string(i % 7) + " b" + std::to_string(i % 11) + " c:0.5"; }
+}  // namespace
+
+TEST(Oaa, SparseClassIndexScoresMatchDenseScores)
+{
+  std::vector<std::string> args = {"--oaa", "20", "--scores", "--quiet", "-b", "20"};
+  auto dense = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  args.push_back("--sparse_class_index");
+  auto sparse = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+
+  for (size_t i = 0; i < 60; i++)
+  {
+    // Predicting first builds the lists of the features, learning afterwards has to keep them up to date.
+    auto* dense_test = VW::read_example(*dense, example_text(i + 3));
+    auto* sparse_test = VW::read_example(*sparse, example_text(i + 3));
+    dense->predict(*dense_test);
+    sparse->predict(*sparse_test);
+    EXPECT_THAT(sparse_test->pred.scalars, testing::Pointwise(testing::Eq(), dense_test->pred.scalars));
+    dense->finish_example(*dense_test);
+    sparse->finish_example(*sparse_test);
+
+    const std::string labeled = std::to_string(i % 20 + 1) + " " + example_text(i);
+    auto* dense_train = VW::read_example(*dense, labeled);
+    auto* sparse_train = VW::read_example(*sparse, labeled);
+    dense->learn(*dense_train);
+    sparse->learn(*sparse_train);
+    dense->finish_example(*dense_train);
+    sparse->finish_example(*sparse_train);
+  }
+}
+
+TEST(Csoaa, SparseClassIndexPredictionsMatchDensePredictions)
+{
+  std::vector<std::string> args = {"--csoaa", "50", "--quiet", "-b", "20"};
+  auto dense = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  args.push_back("--sparse_class_index");
+  auto sparse = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+
+  for (size_t i = 0; i < 100; i++)
+  {
+    auto* dense_test = VW::read_example(*dense, example_text(i + 5));
+    auto* sparse_test = VW::read_example(*sparse, example_text(i + 5));
+    dense->predict(*dense_test);
+    sparse->predict(*sparse_test);
+    EXPECT_EQ(sparse_test->pred.multiclass, dense_test->pred.multiclass);
+    EXPECT_EQ(sparse_test->partial_prediction, dense_test->partial_prediction);
+    dense->finish_example(*dense_test);
+    sparse->finish_example(*sparse_test);
+
+    // Each example only trains three of the classes, so most lists stay short.
+    const std::string labeled = std::to_string(i % 50 + 1) + ":0 " + std::to_string((i * 7) % 50 + 1) + ":1 " +
+        std::to_string((i * 13) % 50 + 1) + ":1 " + example_text(i);
+    auto* dense_train = VW::read_example(*dense, labeled);
+    auto* sparse_train = VW::read_example(*sparse, labeled);
+    dense->learn(*dense_train);
+    sparse->learn(*sparse_train);
+    dense->finish_example(*dense_train);
+    sparse->finish_example(*sparse_train);
+  }
+}
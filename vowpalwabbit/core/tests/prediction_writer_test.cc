@@ -0,0 +1,105 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/prediction_writer.h"
+
+#include "vw/core/global_data.h"
+#include "vw/io/logger.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+VW::v_array<char> make_tag(const std::string& tag)
+{
+  VW::v_array<char> result;
+  result.insert(result.end(), tag.begin(), tag.end());
+  return result;
+}
+}  // namespace
+
+TEST(AsyncPredictionWriter, TextFormatMatchesSynchronousOutput)
+{
+  auto logger = VW::io::create_null_logger();
+  const std::vector<std::pair<float, std::string>> predictions = {
+      {0.f, ""}, {1.f, "tag"}, {-3.f, ""}, {0.25f, "a b"}, {-0.123456789f, "x"}, {12345.5f, ""}};
+
+  auto expected_buffer = std::make_shared<std::vector<char>>();
+  auto expected_writer = VW::io::create_vector_writer(expected_buffer);
+
+  auto actual_buffer = std::make_shared<std::vector<char>>();
+  {
+    // A tiny staging buffer forces records through the whole ring of buffers.
+    VW::async_prediction_writer writer(
+        VW::io::create_vector_writer(actual_buffer), VW::prediction_output_format::TEXT, logger, 16, 2);
+    for (int pass = 0; pass < 50; ++pass)
+    {
+      for (const auto& p : predictions)
+      {
+        auto tag = make_tag(p.second);
+        VW::details::print_result_by_ref(expected_writer.get(), p.first, 0.f, tag, logger);
+        VW::details::print_result_by_ref(&writer, p.first, 0.f, tag, logger);
+      }
+      const std::string raw = "0:0.5,1:0.5\n";
+      expected_writer->write(raw.c_str(), raw.size());
+      writer.write(raw.c_str(), raw.size());
+    }
+    writer.flush();
+    EXPECT_EQ(std::string(actual_buffer->begin(), actual_buffer->end()),
+        std::string(expected_buffer->begin(), expected_buffer->end()));
+  }
+  EXPECT_EQ(std::string(actual_buffer->begin(), actual_buffer->end()),
+      std::string(expected_buffer->begin(), expected_buffer->end()));
+}
+
+TEST(AsyncPredictionWriter, BinaryFormatRecords)
+{
+  auto logger = VW::io::create_null_logger();
+  auto buffer = std::make_shared<std::vector<char>>();
+  {
+    VW::async_prediction_writer writer(
+        VW::io::create_vector_writer(buffer), VW::prediction_output_format::BINARY, logger);
+    writer.write_scalar(0.5f, make_tag("t1"));
+    writer.write("ab", 2);
+    writer.write_scalar(-2.f, make_tag(""));
+  }
+
+  const char* cursor = buffer->data();
+  auto read_u8 = [&]() { return static_cast<uint8_t>(*cursor++); };
+  auto read_u32 = [&]()
+  {
+    uint32_t v;
+    std::memcpy(&v, cursor, sizeof(v));
+    cursor += sizeof(v);
+    return v;
+  };
+  auto read_f32 = [&]()
+  {
+    float v;
+    std::memcpy(&v, cursor, sizeof(v));
+    cursor += sizeof(v);
+    return v;
+  };
+
+  EXPECT_EQ(read_u8(), VW::async_prediction_writer::SCALAR_RECORD);
+  EXPECT_FLOAT_EQ(read_f32(), 0.5f);
+  ASSERT_EQ(read_u32(), 2);
+  EXPECT_EQ(std::string(cursor, 2), "t1");
+  cursor += 2;
+
+  EXPECT_EQ(read_u8(), VW::async_prediction_writer::TEXT_RECORD);
+  ASSERT_EQ(read_u32(), 2);
+  EXPECT_EQ(std::string(cursor, 2), "ab");
+  cursor += 2;
+
+  EXPECT_EQ(read_u8(), VW::async_prediction_writer::SCALAR_RECORD);
+  EXPECT_FLOAT_EQ(read_f32(), -2.f);
+  EXPECT_EQ(read_u32(), 0);
+  EXPECT_EQ(cursor, buffer->data() + buffer->size());
+}
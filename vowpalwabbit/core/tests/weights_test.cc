@@ -4,6 +4,8 @@
 
 #include "vw/core/array_parameters.h"
 #include "vw/core/array_parameters_dense.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -24,4 +26,83 @@ TYPED_TEST(WeightTests, TestDefaultFunctionWeightInitializationStridedIndex)
   auto weight_initializer = [](VW::weight* weights, uint64_t index) { weights[0] = 1.f * index; };
   w.set_default(weight_initializer);
   for (size_t i = 0; i < LENGTH; i++) { EXPECT_FLOAT_EQ(w.strided_index(i), 1.f * (i * w.stride())); }
-}
\ No newline at end of file
+}
+TEST(LazyDenseWeights, DefaultsMatchEagerInitialization)
+{
+  constexpr size_t length = 1 << 12;
+  auto eager = VW::dense_parameters(length, STRIDE_SHIFT);
+  auto lazy = VW::dense_parameters::lazy_allocate(length, STRIDE_SHIFT);
+  EXPECT_TRUE(lazy.is_lazy());
+
+  auto first_initializer = [](VW::weight* weights, uint64_t index)
+  {
+    weights[0] = 1.f * index;
+    weights[1] = 2.f;
+  };
+  auto second_initializer = [](VW::weight* weights, uint64_t /* index */) { weights[2] = 3.f; };
+  for (auto* w : {&eager, &lazy})
+  {
+    w->set_default(first_initializer);
+    w->set_default(second_initializer);
+  }
+
+  lazy.strided_index(3)++;
+  eager.strided_index(3)++;
+  for (auto* w : {&eager, &lazy}) { w->set_zero(1); }
+
+  for (size_t i = 0; i < length; i++)
+  {
+    for (size_t offset = 0; offset < lazy.stride(); offset++)
+    {
+      EXPECT_FLOAT_EQ((&lazy.strided_index(i))[offset], (&eager.strided_index(i))[offset]);
+    }
+  }
+}
+
+TEST(LazyDenseWeights, DeepCopyKeepsWrittenWeights)
+{
+  constexpr size_t length = 1 << 12;
+  auto lazy = VW::dense_parameters::lazy_allocate(length, STRIDE_SHIFT);
+  lazy.strided_index(7) = 4.f;
+  lazy.strided_index(length - 1) = 0.5f;
+
+  auto copy = VW::dense_parameters::deep_copy(lazy);
+  EXPECT_TRUE(copy.is_lazy());
+  copy.strided_index(8) = 2.f;
+
+  EXPECT_FLOAT_EQ(copy.strided_index(7), 4.f);
+  EXPECT_FLOAT_EQ(copy.strided_index(8), 2.f);
+  EXPECT_FLOAT_EQ(copy.strided_index(length - 1), 0.5f);
+  EXPECT_FLOAT_EQ(copy.strided_index(length / 2), 0.f);
+  EXPECT_FLOAT_EQ(lazy.strided_index(8), 0.f);
+}
+
+TEST(LazyDenseWeights, RandomInitializersAreRejected)
+{
+  EXPECT_THROW(VW::initialize(vwtest::make_args("--quiet", "--random_weights", "--lazy_weights")), VW::vw_exception);
+  EXPECT_THROW(
+      VW::initialize(vwtest::make_args("--quiet", "--random_positive_weights", "--lazy_weights")), VW::vw_exception);
+}
+
+TEST(LazyDenseWeights, LearningMatchesEagerWeights)
+{
+  auto eager = VW::initialize(vwtest::make_args("--quiet", "-b", "18", "--initial_weight", "0.1", "--initial_t", "2"));
+  auto lazy = VW::initialize(
+      vwtest::make_args("--quiet", "-b", "18", "--initial_weight", "0.1", "--initial_t", "2", "--lazy_weights"));
+  EXPECT_TRUE(lazy->weights.dense_weights.is_lazy());
+
+  const std::vector<std::string> examples = {"1 | a b c", "-1 | b d:2", "1 |x e f", "| a e"};
+  for (int pass = 0; pass < 3; ++pass)
+  {
+    for (const auto& line : examples)
+    {
+      auto* eager_ex = VW::read_example(*eager, line);
+      auto* lazy_ex = VW::read_example(*lazy, line);
+      eager->learn(*eager_ex);
+      lazy->learn(*lazy_ex);
+      EXPECT_FLOAT_EQ(eager_ex->pred.scalar, lazy_ex->pred.scalar);
+      eager->finish_example(*eager_ex);
+      lazy->finish_example(*lazy_ex);
+    }
+  }
+}
@@ -6,9 +6,16 @@
 
 #include "vw/common/text_utils.h"
 #include "vw/config/option_group_definition.h"
+#include "vw/core/example.h"
 #include "vw/core/global_data.h"
+#include "vw/core/thread_pool.h"
 #include "vw/core/v_array.h"
 
+#include <array>
+#include <exception>
+#include <future>
+#include <memory>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -30,10 +37,57 @@ public:
   std::string csv_header = "";
   std::string csv_ns_value = "";
   bool csv_remove_outer_quotes = true;
+  // Chunked parsing configurations
+  uint64_t csv_parse_threads = 0;
+  uint64_t csv_chunk_lines = 1024;
 };
 
 int parse_csv_examples(VW::workspace* all, io_buf& buf, VW::multi_ex& examples);
 
+namespace details
+{
+// Hashing layout of a single feature column, derived from the header.
+class csv_column_layout
+{
+public:
+  size_t column_index = 0;
+  // hash(feature_name, namespace_hash), the seed for string valued cells.
+  uint64_t feature_name_hash = 0;
+};
+
+// Hashing layout of all the columns that share a namespace, derived from the header.
+class csv_namespace_layout
+{
+public:
+  std::string ns;
+  unsigned char index = 0;
+  uint64_t channel_hash = 0;
+  float channel_value = 1.f;
+  std::vector<csv_column_layout> columns;
+};
+
+// A line read ahead of time and parsed by a worker thread into a scratch example.
+class csv_row
+{
+public:
+  std::string line;
+  size_t line_num = 0;
+  std::string label;
+  VW::example ex;
+  std::exception_ptr error;
+};
+
+class csv_chunk
+{
+public:
+  std::vector<csv_row> rows;
+  size_t size = 0;
+  size_t next = 0;
+  bool eof = false;
+  std::vector<std::future<void>> futures;
+};
+}  // namespace details
+
 class csv_parser : public VW::details::input_parser
 {
 public:
@@ -45,16 +99,22 @@ public:
   VW::v_array<size_t> tag_list;
   std::unordered_map<std::string, VW::v_array<size_t>> feature_list;
   std::unordered_map<std::string, float> ns_value;
+  // Compiled once the header and namespace values are known, so rows only hash the cell values.
+  std::vector<details::csv_namespace_layout> layout;
+  // Distinct feature space indices written by the layout.
+  std::vector<unsigned char> layout_indices;
 
-  explicit csv_parser(csv_parser_options options) : VW::details::input_parser("csv"), options(std::move(options)) {}
-  ~csv_parser() override = default;
+  explicit csv_parser(csv_parser_options options);
+  ~csv_parser() override;
 
   static void set_parse_args(VW::config::option_group_definition& in_options, csv_parser_options& parsed_options);
   static void handle_parse_args(csv_parser_options& parsed_options);
 
   bool next(VW::workspace& all, io_buf& buf, VW::multi_ex& examples) override
   {
-    return parse_csv(&all, examples[0], buf) != 0;
+    // The header is always handled on the calling thread, chunking starts after it.
+    if (_thread_pool == nullptr || header_fn.empty()) { return parse_csv(&all, examples[0], buf) != 0; }
+    return parse_chunked(&all, examples[0], buf);
   }
 
 private:
@@ -62,6 +122,16 @@ private:
   void reset();
   int parse_csv(VW::workspace* all, VW::example* ae, io_buf& buf);
   size_t read_line(VW::workspace* all, VW::example* ae, io_buf& buf);
+
+  bool parse_chunked(VW::workspace* all, VW::example* ae, io_buf& buf);
+  void fill_chunk(VW::workspace* all, details::csv_chunk& chunk, io_buf& buf);
+  void wait_for_chunk(details::csv_chunk& chunk);
+
+  std::unique_ptr<VW::thread_pool> _thread_pool;
+  // Double buffered so that workers parse the next chunk while the current one is consumed.
+  std::array<details::csv_chunk, 2> _chunks;
+  size_t _current_chunk = 0;
+  bool _chunk_in_flight = false;
 };
 }  // namespace csv
 }  // namespace parsers
@@ -9,6 +9,7 @@
 #include "vw/core/parse_primitives.h"
 #include "vw/core/parser.h"
 
+#include <algorithm>
 #include <string>
 
 namespace VW
@@ -79,6 +80,15 @@ void csv_parser::set_parse_args(VW::config::option_group_definition& in_options,
                .default_value("")
                .help("CSV Parser: Scale the namespace values by specifying the float "
                      "ratio. e.g. --csv_ns_value=a:0.5,b:0.3,:8 ")
+               .experimental())
+      .add(VW::config::make_option("csv_parse_threads", parsed_options.csv_parse_threads)
+               .default_value(0)
+               .help("CSV Parser: Number of worker threads that parse newline aligned chunks of the input. "
+                     "0 parses every line on the parser thread.")
+               .experimental())
+      .add(VW::config::make_option("csv_chunk_lines", parsed_options.csv_chunk_lines)
+               .default_value(1024)
+               .help("CSV Parser: Number of lines in a chunk handed to the worker threads of --csv_parse_threads")
                .experimental());
 }
 
@@ -101,16 +111,42 @@ void csv_parser::handle_parse_args(csv_parser_options& parsed_options)
     {
       THROW("No header specified while --csv_no_file_header is set.");
     }
+
+    if (parsed_options.csv_chunk_lines == 0) { THROW("--csv_chunk_lines must be greater than 0."); }
   }
 }
 
+namespace
+{
+void parse_label_cell(VW::workspace* all, VW::example* ae, VW::string_view label_content)
+{
+  all->parser_runtime.example_parser->words.clear();
+  VW::tokenize(' ', label_content, all->parser_runtime.example_parser->words);
+
+  if (!all->parser_runtime.example_parser->words.empty())
+  {
+    all->parser_runtime.example_parser->lbl_parser.parse_label(ae->l, ae->ex_reduction_features,
+        all->parser_runtime.example_parser->parser_memory_to_reuse, all->sd->ldict.get(),
+        all->parser_runtime.example_parser->words, all->logger);
+  }
+}
+}  // namespace
+
 class CSV_parser
 {
 public:
   CSV_parser(VW::workspace* all, VW::example* ae, VW::string_view csv_line, VW::parsers::csv::csv_parser* parser)
-      : _parser(parser), _all(all), _ae(ae)
+      : CSV_parser(all, ae, csv_line, parser, parser->line_num, nullptr)
+  {
+  }
+
+  // When deferred_label is set the line must be a data line. The label cell is then stored there instead of being
+  // parsed, as label parsing uses state shared by the whole parser and cannot run on a worker thread.
+  CSV_parser(VW::workspace* all, VW::example* ae, VW::string_view csv_line, VW::parsers::csv::csv_parser* parser,
+      size_t line_num, std::string* deferred_label)
+      : _parser(parser), _all(all), _ae(ae), _line_num(line_num), _deferred_label(deferred_label)
   {
-    if (csv_line.empty()) { THROW("Malformed CSV, empty line at " << _parser->line_num << "!"); }
+    if (csv_line.empty()) { THROW("Malformed CSV, empty line at " << _line_num << "!"); }
     else
     {
       _csv_line = split(csv_line, parser->options.csv_separator[0], true);
@@ -123,10 +159,11 @@ private:
   VW::parsers::csv::csv_parser* _parser;
   VW::workspace* _all;
   VW::example* _ae;
+  size_t _line_num;
+  std::string* _deferred_label;
   VW::v_array<VW::string_view> _csv_line;
   std::vector<std::string> _token_storage;
   size_t _anon{};
-  uint64_t _channel_hash{};
 
   inline FORCE_INLINE void parse_line()
   {
@@ -146,11 +183,13 @@ private:
 
       // Store the ns value from CmdLine
       if (_parser->ns_value.empty() && !_parser->options.csv_ns_value.empty()) { parse_ns_value(); }
+
+      compile_layout();
     }
 
     if (_csv_line.size() != _parser->header_fn.size())
     {
-      THROW("CSV line " << _parser->line_num << " has " << _csv_line.size() << " elements, but the header has "
+      THROW("CSV line " << _line_num << " has " << _csv_line.size() << " elements, but the header has "
                         << _parser->header_fn.size() << " elements!");
     }
     else if (!this_line_is_header) { parse_example(); }
@@ -222,9 +261,51 @@ private:
     }
   }
 
+  inline FORCE_INLINE void compile_layout()
+  {
+    _parser->layout.clear();
+    _parser->layout_indices.clear();
+    for (const auto& f : _parser->feature_list)
+    {
+      VW::parsers::csv::details::csv_namespace_layout ns_layout;
+      if (f.first.empty())
+      {
+        ns_layout.ns = " ";
+        ns_layout.channel_hash =
+            _all->runtime_config.hash_seed == 0 ? 0 : VW::uniform_hash("", 0, _all->runtime_config.hash_seed);
+      }
+      else
+      {
+        ns_layout.ns = f.first;
+        ns_layout.channel_hash =
+            _all->parser_runtime.example_parser->hasher(f.first.data(), f.first.length(), _all->runtime_config.hash_seed);
+      }
+      ns_layout.index = static_cast<unsigned char>(ns_layout.ns[0]);
+
+      auto it = _parser->ns_value.find(f.first);
+      if (it != _parser->ns_value.end()) { ns_layout.channel_value = it->second; }
+
+      for (size_t column_index : f.second)
+      {
+        const std::string& feature_name = _parser->header_fn[column_index];
+        VW::parsers::csv::details::csv_column_layout column;
+        column.column_index = column_index;
+        column.feature_name_hash = _all->parser_runtime.example_parser->hasher(
+            feature_name.data(), feature_name.length(), ns_layout.channel_hash);
+        ns_layout.columns.push_back(column);
+      }
+      if (std::find(_parser->layout_indices.begin(), _parser->layout_indices.end(), ns_layout.index) ==
+          _parser->layout_indices.end())
+      {
+        _parser->layout_indices.push_back(ns_layout.index);
+      }
+      _parser->layout.push_back(std::move(ns_layout));
+    }
+  }
+
   inline FORCE_INLINE void parse_example()
   {
-    _all->parser_runtime.example_parser->lbl_parser.default_label(_ae->l);
+    if (_deferred_label == nullptr) { _all->parser_runtime.example_parser->lbl_parser.default_label(_ae->l); }
     if (!_parser->label_list.empty()) { parse_label(); }
     if (!_parser->tag_list.empty()) { parse_tag(); }
 
@@ -236,15 +317,8 @@ private:
     VW::string_view label_content = _csv_line[_parser->label_list[0]];
     if (_parser->options.csv_remove_outer_quotes) { remove_quotation_marks(label_content); }
 
-    _all->parser_runtime.example_parser->words.clear();
-    VW::tokenize(' ', label_content, _all->parser_runtime.example_parser->words);
-
-    if (!_all->parser_runtime.example_parser->words.empty())
-    {
-      _all->parser_runtime.example_parser->lbl_parser.parse_label(_ae->l, _ae->ex_reduction_features,
-          _all->parser_runtime.example_parser->parser_memory_to_reuse, _all->sd->ldict.get(),
-          _all->parser_runtime.example_parser->words, _all->logger);
-    }
+    if (_deferred_label != nullptr) { _deferred_label->assign(label_content.data(), label_content.size()); }
+    else { parse_label_cell(_all, _ae, label_content); }
   }
 
   inline FORCE_INLINE void parse_tag()
@@ -259,52 +333,30 @@ private:
   {
     // Mark to check if all the cells in the line is empty
     bool empty_line = true;
-    for (auto& f : _parser->feature_list)
+    for (const auto& ns_layout : _parser->layout)
     {
       _anon = 0;
-      VW::string_view ns;
-      bool new_index = false;
-      if (f.first.empty())
-      {
-        ns = " ";
-        _channel_hash =
-            _all->runtime_config.hash_seed == 0 ? 0 : VW::uniform_hash("", 0, _all->runtime_config.hash_seed);
-      }
-      else
-      {
-        ns = f.first;
-        _channel_hash =
-            _all->parser_runtime.example_parser->hasher(ns.data(), ns.length(), _all->runtime_config.hash_seed);
-      }
-
-      unsigned char _index = static_cast<unsigned char>(ns[0]);
-      if (_ae->feature_space[_index].size() == 0) { new_index = true; }
-
-      float _cur_channel_v = 1.f;
-      if (!_parser->ns_value.empty())
-      {
-        auto it = _parser->ns_value.find(f.first);
-        if (it != _parser->ns_value.end()) { _cur_channel_v = it->second; }
-      }
-      _ae->feature_space[_index].start_ns_extent(_channel_hash);
+      features& fs = _ae->feature_space[ns_layout.index];
+      bool new_index = fs.size() == 0;
+      fs.start_ns_extent(ns_layout.channel_hash);
 
-      for (size_t i = 0; i < f.second.size(); i++)
+      for (const auto& column : ns_layout.columns)
       {
-        size_t column_index = f.second[i];
-        empty_line = empty_line && _csv_line[column_index].empty();
-        parse_features(_ae->feature_space[_index], column_index, _cur_channel_v, ns);
+        empty_line = empty_line && _csv_line[column.column_index].empty();
+        parse_features(fs, column, ns_layout);
       }
 
-      _ae->feature_space[_index].end_ns_extent();
-      if (new_index && _ae->feature_space[_index].size() > 0) { _ae->indices.emplace_back(_index); }
+      fs.end_ns_extent();
+      if (new_index && fs.size() > 0) { _ae->indices.emplace_back(ns_layout.index); }
     }
     _ae->is_newline = empty_line;
   }
 
-  inline FORCE_INLINE void parse_features(features& fs, size_t column_index, float cur_channel_v, VW::string_view ns)
+  inline FORCE_INLINE void parse_features(features& fs, const VW::parsers::csv::details::csv_column_layout& column,
+      const VW::parsers::csv::details::csv_namespace_layout& ns_layout)
   {
-    VW::string_view feature_name = _parser->header_fn[column_index];
-    VW::string_view string_feature_value = _csv_line[column_index];
+    VW::string_view feature_name = _parser->header_fn[column.column_index];
+    VW::string_view string_feature_value = _csv_line[column.column_index];
 
     uint64_t word_hash;
     float _v;
@@ -322,27 +374,21 @@ private:
 
     if (!is_feature_float && _parser->options.csv_remove_outer_quotes) { remove_quotation_marks(string_feature_value); }
 
-    if (is_feature_float) { _v = cur_channel_v * parsed_feature_value; }
+    if (is_feature_float) { _v = ns_layout.channel_value * parsed_feature_value; }
     else { _v = 1; }
 
     // Case where feature value is string
     if (!is_feature_float)
     {
       // chain hash is hash(feature_value, hash(feature_name, namespace_hash)) & parse_mask
-      word_hash =
-          (_all->parser_runtime.example_parser->hasher(string_feature_value.data(), string_feature_value.length(),
-               _all->parser_runtime.example_parser->hasher(feature_name.data(), feature_name.length(), _channel_hash)) &
-              _all->runtime_state.parse_mask);
+      word_hash = (_all->parser_runtime.example_parser->hasher(
+                       string_feature_value.data(), string_feature_value.length(), column.feature_name_hash) &
+          _all->runtime_state.parse_mask);
     }
     // Case where feature value is float and feature name is not empty
-    else if (!feature_name.empty())
-    {
-      word_hash =
-          (_all->parser_runtime.example_parser->hasher(feature_name.data(), feature_name.length(), _channel_hash) &
-              _all->runtime_state.parse_mask);
-    }
+    else if (!feature_name.empty()) { word_hash = (column.feature_name_hash & _all->runtime_state.parse_mask); }
     // Case where feature value is float and feature name is empty
-    else { word_hash = _channel_hash + _anon++; }
+    else { word_hash = ns_layout.channel_hash + _anon++; }
 
     // don't add 0 valued features to list of features
     if (_v == 0) { return; }
@@ -353,9 +399,9 @@ private:
       if (!is_feature_float)
       {
         fs.space_names.emplace_back(
-            VW::audit_strings(std::string{ns}, std::string{feature_name}, std::string{string_feature_value}));
+            VW::audit_strings(ns_layout.ns, std::string{feature_name}, std::string{string_feature_value}));
       }
-      else { fs.space_names.emplace_back(VW::audit_strings(std::string{ns}, std::string{feature_name})); }
+      else { fs.space_names.emplace_back(VW::audit_strings(ns_layout.ns, std::string{feature_name})); }
     }
   }
 
@@ -379,7 +425,7 @@ private:
 
     for (size_t i = 0; i <= sv.length(); i++)
     {
-      if (i == sv.length() && inside_quotes) { THROW("Unclosed quote at end of line " << _parser->line_num << "."); }
+      if (i == sv.length() && inside_quotes) { THROW("Unclosed quote at end of line " << _line_num << "."); }
       // Skip Quotes at the start and end of the cell
       else if (use_quotes && !inside_quotes && i == pointer && i < sv.length() && sv[i] == '"')
       {
@@ -401,7 +447,7 @@ private:
       else if (use_quotes && inside_quotes && i < sv.length() && sv[i] == '"')
       {
         THROW("Unescaped quote at position "
-            << i + 1 << " of line " << _parser->line_num
+            << i + 1 << " of line " << _line_num
             << ", double-quote appearing inside a cell must be escaped by preceding it with another double-quote!");
       }
       else if (i == sv.length() || (!inside_quotes && sv[i] == ch))
@@ -458,6 +504,22 @@ private:
   }
 };
 
+csv_parser::csv_parser(csv_parser_options options)
+    : VW::details::input_parser("csv"), options(std::move(options))
+{
+  if (this->options.csv_parse_threads > 0)
+  {
+    _thread_pool = VW::make_unique<VW::thread_pool>(this->options.csv_parse_threads);
+    for (auto& chunk : _chunks) { chunk.rows.resize(this->options.csv_chunk_lines); }
+  }
+}
+
+csv_parser::~csv_parser()
+{
+  // Workers write into the chunks, they must be done before the chunks go away.
+  for (auto& chunk : _chunks) { wait_for_chunk(chunk); }
+}
+
 void csv_parser::reset()
 {
   if (options.csv_header.empty())
@@ -467,6 +529,8 @@ void csv_parser::reset()
     label_list.clear();
     tag_list.clear();
     feature_list.clear();
+    layout.clear();
+    layout_indices.clear();
   }
   line_num = 0;
 }
@@ -505,6 +569,118 @@ size_t csv_parser::read_line(VW::workspace* all, VW::example* ae, io_buf& buf)
   return num_chars_initial;
 }
 
+bool csv_parser::parse_chunked(VW::workspace* all, VW::example* ae, io_buf& buf)
+{
+  auto* chunk = &_chunks[_current_chunk];
+  if (chunk->next == chunk->size)
+  {
+    if (chunk->eof)
+    {
+      // EOF is reached, reset for possible next file.
+      for (auto& c : _chunks)
+      {
+        c.size = 0;
+        c.next = 0;
+        c.eof = false;
+      }
+      reset();
+      return false;
+    }
+
+    // Prime the pipeline on the first call after the header, afterwards the other chunk is already in flight.
+    auto& other = _chunks[1 - _current_chunk];
+    if (!_chunk_in_flight) { fill_chunk(all, other, buf); }
+    wait_for_chunk(other);
+    _chunk_in_flight = false;
+    _current_chunk = 1 - _current_chunk;
+    chunk = &other;
+
+    // Let the workers parse ahead while this chunk is consumed.
+    if (!chunk->eof)
+    {
+      fill_chunk(all, _chunks[1 - _current_chunk], buf);
+      _chunk_in_flight = true;
+    }
+    // Only a chunk that hit EOF can be empty.
+    if (chunk->size == 0) { return parse_chunked(all, ae, buf); }
+  }
+
+  auto& row = chunk->rows[chunk->next++];
+  if (row.error) { std::rethrow_exception(row.error); }
+
+  all->parser_runtime.example_parser->lbl_parser.default_label(ae->l);
+  if (!label_list.empty()) { parse_label_cell(all, ae, row.label); }
+  ae->tag.insert(ae->tag.end(), row.ex.tag.begin(), row.ex.tag.end());
+  for (auto index : layout_indices) { std::swap(ae->feature_space[index], row.ex.feature_space[index]); }
+  for (auto index : row.ex.indices) { ae->indices.push_back(index); }
+  ae->is_newline = row.ex.is_newline;
+  return true;
+}
+
+void csv_parser::fill_chunk(VW::workspace* all, details::csv_chunk& chunk, io_buf& buf)
+{
+  chunk.size = 0;
+  chunk.next = 0;
+  while (chunk.size < chunk.rows.size())
+  {
+    char* line = nullptr;
+    size_t num_chars = buf.readto(line, '\n');
+    if (num_chars == 0)
+    {
+      chunk.eof = true;
+      break;
+    }
+
+    if (line[0] == '\xef' && num_chars >= 3 && line[1] == '\xbb' && line[2] == '\xbf')
+    {
+      line += 3;
+      num_chars -= 3;
+    }
+    if (num_chars > 0 && line[num_chars - 1] == '\n') { num_chars--; }
+    if (num_chars > 0 && line[num_chars - 1] == '\r') { num_chars--; }
+
+    // The io_buf may shift its contents on the next read, so the line is copied into storage owned by the row.
+    auto& row = chunk.rows[chunk.size++];
+    row.line.assign(line, num_chars);
+    row.line_num = ++line_num;
+  }
+
+  auto parse_rows = [all, this](details::csv_chunk* chunk, size_t begin, size_t end) -> void
+  {
+    for (size_t i = begin; i < end; ++i)
+    {
+      auto& row = chunk->rows[i];
+      for (auto index : layout_indices) { row.ex.feature_space[index].clear(); }
+      row.ex.indices.clear();
+      row.ex.tag.clear();
+      row.label.clear();
+      row.error = nullptr;
+      try
+      {
+        CSV_parser parse_line(all, &row.ex, row.line, this, row.line_num, &row.label);
+      }
+      catch (...)
+      {
+        // Rethrown when the row is consumed, so that errors surface in input order.
+        row.error = std::current_exception();
+      }
+    }
+  };
+
+  const size_t block_size = std::max(size_t(1), (chunk.size + _thread_pool->size() - 1) / _thread_pool->size());
+  for (size_t begin = 0; begin < chunk.size; begin += block_size)
+  {
+    chunk.futures.emplace_back(
+        _thread_pool->submit(parse_rows, &chunk, begin, std::min(begin + block_size, chunk.size)));
+  }
+}
+
+void csv_parser::wait_for_chunk(details::csv_chunk& chunk)
+{
+  for (auto& ft : chunk.futures) { ft.get(); }
+  chunk.futures.clear();
+}
+
 }  // namespace csv
 }  // namespace parsers
 }  // namespace VW
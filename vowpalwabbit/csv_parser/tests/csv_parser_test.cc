@@ -689,3 +689,90 @@ TEST(CsvParser, MultilineExamples)
   VW::finish_example(*vw, *examples[0]);
   examples.clear();
 }
+
+TEST(CsvParser, ChunkedParsingMatchesSerialParsing)
+{
+  std::string example_string = "a|x,a|y,b|z,_label,_tag,w\n";
+  for (int i = 0; i < 11; i++)
+  {
+    example_string += std::to_string(i) + "," + std::to_string(i % 3) + ",\"s" + std::to_string(i % 4) + "\"," +
+        std::to_string(i % 2 == 0 ? 1 : -1) + ",t" + std::to_string(i) + "," + (i % 5 == 0 ? "" : "0.5") + "\n";
+  }
+
+  auto serial_vw = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-a", "--csv"));
+  auto chunked_vw = VW::initialize(vwtest::make_args(
+      "--no_stdin", "--quiet", "-a", "--csv", "--csv_parse_threads", "2", "--csv_chunk_lines", "3"));
+
+  VW::io_buf serial_buffer;
+  serial_buffer.add_file(VW::io::create_buffer_view(example_string.data(), example_string.size()));
+  VW::io_buf chunked_buffer;
+  chunked_buffer.add_file(VW::io::create_buffer_view(example_string.data(), example_string.size()));
+
+  for (int i = 0; i < 11; i++)
+  {
+    VW::multi_ex serial_examples;
+    serial_examples.push_back(&VW::get_unused_example(serial_vw.get()));
+    EXPECT_EQ(serial_vw->parser_runtime.example_parser->reader(serial_vw.get(), serial_buffer, serial_examples), 1);
+    VW::multi_ex chunked_examples;
+    chunked_examples.push_back(&VW::get_unused_example(chunked_vw.get()));
+    EXPECT_EQ(chunked_vw->parser_runtime.example_parser->reader(chunked_vw.get(), chunked_buffer, chunked_examples), 1);
+
+    auto& serial = *serial_examples[0];
+    auto& chunked = *chunked_examples[0];
+    EXPECT_FLOAT_EQ(serial.l.simple.label, chunked.l.simple.label);
+    EXPECT_EQ(std::string(serial.tag.begin(), serial.tag.end()), std::string(chunked.tag.begin(), chunked.tag.end()));
+    EXPECT_EQ(serial.indices.size(), chunked.indices.size());
+    for (auto ns : {'a', 'b', ' '})
+    {
+      const auto& serial_fs = serial.feature_space[static_cast<unsigned char>(ns)];
+      const auto& chunked_fs = chunked.feature_space[static_cast<unsigned char>(ns)];
+      EXPECT_EQ(serial_fs.size(), chunked_fs.size());
+      EXPECT_EQ(serial_fs.namespace_extents, chunked_fs.namespace_extents);
+      for (size_t j = 0; j < serial_fs.size() && j < chunked_fs.size(); j++)
+      {
+        EXPECT_FLOAT_EQ(serial_fs.values[j], chunked_fs.values[j]);
+        EXPECT_EQ(serial_fs.indices[j], chunked_fs.indices[j]);
+        EXPECT_EQ(serial_fs.space_names[j].name, chunked_fs.space_names[j].name);
+        EXPECT_EQ(serial_fs.space_names[j].str_value, chunked_fs.space_names[j].str_value);
+      }
+    }
+
+    VW::finish_example(*serial_vw, serial);
+    VW::finish_example(*chunked_vw, chunked);
+  }
+
+  VW::multi_ex examples;
+  examples.push_back(&VW::get_unused_example(chunked_vw.get()));
+  EXPECT_EQ(chunked_vw->parser_runtime.example_parser->reader(chunked_vw.get(), chunked_buffer, examples), 0);
+  VW::finish_example(*chunked_vw, *examples[0]);
+}
+
+TEST(CsvParser, ChunkedParsingReportsErrorsInOrder)
+{
+  std::string example_string =
+      // Header
+      "a,_label\n"
+      // Examples
+      "1,1\n"
+      "2,1\n"
+      "\"3,1\n";
+
+  auto vw = VW::initialize(vwtest::make_args(
+      "--no_stdin", "--quiet", "--csv", "--csv_parse_threads", "2", "--csv_chunk_lines", "4"));
+  VW::io_buf buffer;
+  buffer.add_file(VW::io::create_buffer_view(example_string.data(), example_string.size()));
+
+  for (float expected_value : {1.f, 2.f})
+  {
+    VW::multi_ex examples;
+    examples.push_back(&VW::get_unused_example(vw.get()));
+    EXPECT_EQ(vw->parser_runtime.example_parser->reader(vw.get(), buffer, examples), 1);
+    EXPECT_FLOAT_EQ(examples[0]->feature_space[' '].values[0], expected_value);
+    VW::finish_example(*vw, *examples[0]);
+  }
+
+  VW::multi_ex examples;
+  examples.push_back(&VW::get_unused_example(vw.get()));
+  EXPECT_THROW(vw->parser_runtime.example_parser->reader(vw.get(), buffer, examples), VW::vw_exception);
+  VW::finish_example(*vw, *examples[0]);
+}
@@ -97,6 +97,8 @@ private:
 };
 
 std::unique_ptr<writer> open_file_writer(const std::string& file_path);
+/// Opens file_path for writing at its end, creating it if it does not exist.
+std::unique_ptr<writer> open_file_append_writer(const std::string& file_path);
 std::unique_ptr<reader> open_file_reader(const std::string& file_path);
 std::unique_ptr<writer> open_compressed_file_writer(const std::string& file_path);
 std::unique_ptr<reader> open_compressed_file_reader(const std::string& file_path);
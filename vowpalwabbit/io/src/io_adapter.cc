@@ -45,7 +45,8 @@ using namespace VW::io;
 enum class file_mode
 {
   READ,
-  WRITE
+  WRITE,
+  APPEND
 };
 
 int get_stdin_fileno()
@@ -193,6 +194,11 @@ std::unique_ptr<writer> open_file_writer(const std::string& file_path)
   return std::unique_ptr<writer>(new file_adapter(file_path.c_str(), file_mode::WRITE));
 }
 
+std::unique_ptr<writer> open_file_append_writer(const std::string& file_path)
+{
+  return std::unique_ptr<writer>(new file_adapter(file_path.c_str(), file_mode::APPEND));
+}
+
 std::unique_ptr<reader> open_file_reader(const std::string& file_path)
 {
   return std::unique_ptr<reader>(new file_adapter(file_path.c_str(), file_mode::READ));
@@ -299,6 +305,11 @@ file_adapter::file_adapter(const char* filename, file_mode mode)
     // _O_SEQUENTIAL hints to OS that we'll be reading sequentially, so cache aggressively.
     _sopen_s(&_file_descriptor, filename, _O_RDONLY | _O_BINARY | _O_SEQUENTIAL, _SH_DENYWR, 0);
   }
+  else if (_mode == file_mode::APPEND)
+  {
+    _sopen_s(
+        &_file_descriptor, filename, _O_CREAT | _O_WRONLY | _O_BINARY | _O_APPEND, _SH_DENYWR, _S_IREAD | _S_IWRITE);
+  }
   else
   {
     _sopen_s(
@@ -306,6 +317,10 @@ file_adapter::file_adapter(const char* filename, file_mode mode)
   }
 #else
   if (_mode == file_mode::READ) { _file_descriptor = open(filename, O_RDONLY | O_LARGEFILE); }
+  else if (_mode == file_mode::APPEND)
+  {
+    _file_descriptor = open(filename, O_CREAT | O_WRONLY | O_LARGEFILE | O_APPEND, 0666);
+  }
   else { _file_descriptor = open(filename, O_CREAT | O_WRONLY | O_LARGEFILE | O_TRUNC, 0666); }
 #endif
 
@@ -329,7 +344,7 @@ ssize_t file_adapter::read(char* buffer, size_t num_bytes)
 
 ssize_t file_adapter::write(const char* buffer, size_t num_bytes)
 {
-  assert(_mode == file_mode::WRITE);
+  assert(_mode != file_mode::READ);
 #ifdef _WIN32
   return ::_write(_file_descriptor, buffer, (unsigned int)num_bytes);
 #else
@@ -387,7 +402,7 @@ ssize_t gzip_file_adapter::read(char* buffer, size_t num_bytes)
 
 ssize_t gzip_file_adapter::write(const char* buffer, size_t num_bytes)
 {
-  assert(_mode == file_mode::WRITE);
+  assert(_mode != file_mode::READ);
 
   auto num_written = gzwrite(_gz_file, buffer, static_cast<unsigned int>(num_bytes));
   return (num_written > 0) ? static_cast<size_t>(num_written) : 0;